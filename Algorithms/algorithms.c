@@ -1,6 +1,11 @@
+#ifndef c_dsa_generic_algorithms_c
+#define c_dsa_generic_algorithms_c
+
 #include "algorithms.h"
 #include "sorting.h"
+#include "../Memory/allocator.c" // TODO: Remove this
 #include "sorting.c" // TODO: Remove this
+#include "type.c" // TODO: Remove this
 #include "stddef.h"
 #include "string.h"
 #include "stdlib.h"
@@ -178,3 +183,5 @@ void swap(void* a, void* b, size_t element_size) {
       ((byte*)b)[i] = temp;
    }
 }
+
+#endif // c_dsa_generic_algorithms_c
@@ -1,5 +1,7 @@
+#include "assert.h"
 #include "stddef.h"
 #include "string.h"
+#include "../Memory/allocator.h"
 
 void selection_sort(void* start, void* end, size_t element_size, int (*cmp)(void*, void*)) {
    void* i = start;
@@ -13,11 +15,7 @@ void selection_sort(void* start, void* end, size_t element_size, int (*cmp)(void
          j += element_size;
       }
       if (min != i) {
-         void* tmp = malloc(element_size);
-         memcpy(tmp, i, element_size);
-         memcpy(i, min, element_size);
-         memcpy(min, tmp, element_size);
-         free(tmp);
+         swap(i, min, element_size);
       }
       i += element_size;
    }
@@ -44,6 +42,9 @@ void quick_sort(void* start, void* end, size_t element_size, int (*cmp)(void*, v
       }
       if (left <= right) {
          swap(left, right, element_size);
+         // The pivot value moved with the swap, keep pointing at it.
+         if (pivot == left) pivot = right;
+         else if (pivot == right) pivot = left;
          left += element_size;
          right -= element_size;
       }
@@ -53,7 +54,7 @@ void quick_sort(void* start, void* end, size_t element_size, int (*cmp)(void*, v
    quick_sort(left, end, element_size, cmp);
 }
 
-void merge_sort(void* start, void* end, size_t element_size, int (*cmp)(void*, void*)) {
+void _merge_sort(void* start, void* end, size_t element_size, int (*cmp)(void*, void*), void* temp) {
    size_t total_size = end - start;
    size_t n = total_size / element_size;
 
@@ -63,10 +64,9 @@ void merge_sort(void* start, void* end, size_t element_size, int (*cmp)(void*, v
 
    void* mid = start + (n / 2) * element_size;
 
-   merge_sort(start, mid, element_size, cmp);
-   merge_sort(mid, end, element_size, cmp);
+   _merge_sort(start, mid, element_size, cmp, temp);
+   _merge_sort(mid, end, element_size, cmp, temp);
 
-   void* temp = malloc(total_size);
    void* left = start;
    void* right = mid;
    void* ptr = temp;
@@ -95,7 +95,20 @@ void merge_sort(void* start, void* end, size_t element_size, int (*cmp)(void*, v
    }
 
    memcpy(start, temp, total_size);
-   free(temp);
+}
+
+void merge_sort_with_allocator(void* start, void* end, size_t element_size, int (*cmp)(void*, void*), dsa_allocator* allocator) {
+   size_t total_size = end - start;
+   if (total_size <= element_size) return;
+   // One scratch buffer for the whole sort, every merge reuses it.
+   void* temp = dsa_alloc(allocator, total_size);
+   assert(temp && "Not Enough Memory!");
+   _merge_sort(start, end, element_size, cmp, temp);
+   dsa_free(allocator, temp, total_size);
+}
+
+void merge_sort(void* start, void* end, size_t element_size, int (*cmp)(void*, void*)) {
+   merge_sort_with_allocator(start, end, element_size, cmp, NULL);
 }
 
 void insertion_sort(void* start, void* end, size_t element_size, int (*cmp)(void*, void*)) {
@@ -1,4 +1,5 @@
 #include "stddef.h"
+#include "../Memory/allocator.h"
 
 #ifndef c_dsa_generic_util_sorting
 #define c_dsa_generic_util_sorting
@@ -9,6 +10,10 @@ void quick_sort(void* start, void* end, size_t element_size, int (*cmp)(void*, v
 
 void merge_sort(void* start, void* end, size_t element_size, int (*cmp)(void*, void*));
 
+void _merge_sort(void* start, void* end, size_t element_size, int (*cmp)(void*, void*), void* temp);
+
+void merge_sort_with_allocator(void* start, void* end, size_t element_size, int (*cmp)(void*, void*), dsa_allocator* allocator);
+
 void insertion_sort(void* start, void* end, size_t element_size, int (*cmp)(void*, void*));
 
 void _heap_ify(void* start, size_t size, int i, size_t element_size, int (*cmp)(void*, void*));
@@ -0,0 +1,287 @@
+#ifndef c_dsa_generic_type_c
+#define c_dsa_generic_type_c
+
+#include "type.h"
+#include "algorithms.h"
+#include "sorting.h"
+#include "assert.h"
+#include "stdlib.h"
+#include "string.h"
+
+// Comparator, equality and descriptor of a primitive type.
+#define __DSA_PRIMITIVE(name, ctype, tag_value)                                                     \
+   static int __dsa_##name##_cmp(void* a, void* b) {                                               \
+      ctype x = *(ctype*)a, y = *(ctype*)b;                                                         \
+      return (x > y) - (x < y);                                                                     \
+   }                                                                                                \
+   static int __dsa_##name##_equals(void* a, void* b) {                                            \
+      return *(ctype*)a == *(ctype*)b;                                                              \
+   }                                                                                                \
+   const dsa_type dsa_type_##name = { #name, sizeof(ctype), _Alignof(ctype), tag_value,              \
+                                      __dsa_##name##_cmp, NULL, __dsa_##name##_equals, NULL, NULL };
+
+__DSA_PRIMITIVE(i8, int8_t, DSA_TYPE_I8)
+__DSA_PRIMITIVE(u8, uint8_t, DSA_TYPE_U8)
+__DSA_PRIMITIVE(i16, int16_t, DSA_TYPE_I16)
+__DSA_PRIMITIVE(u16, uint16_t, DSA_TYPE_U16)
+__DSA_PRIMITIVE(i32, int32_t, DSA_TYPE_I32)
+__DSA_PRIMITIVE(u32, uint32_t, DSA_TYPE_U32)
+__DSA_PRIMITIVE(i64, int64_t, DSA_TYPE_I64)
+__DSA_PRIMITIVE(u64, uint64_t, DSA_TYPE_U64)
+__DSA_PRIMITIVE(f32, float, DSA_TYPE_F32)
+__DSA_PRIMITIVE(f64, double, DSA_TYPE_F64)
+
+static const dsa_type* __dsa_type_registry[DSA_TYPE_REGISTRY_CAPACITY] = {
+   &dsa_type_i8,  &dsa_type_u8,  &dsa_type_i16, &dsa_type_u16, &dsa_type_i32,
+   &dsa_type_u32, &dsa_type_i64, &dsa_type_u64, &dsa_type_f32, &dsa_type_f64,
+};
+static size_t __dsa_type_count = 10;
+
+/**
+ * @brief Function to check if a descriptor stands for a primitive type.
+ * @param type The descriptor.
+ * @return 1 for the primitive types, 0 for DSA_TYPE_CUSTOM.
+ * Time complexity: O(1)
+ */
+int dsa_type_is_primitive(const dsa_type* type) {
+   return type->tag != DSA_TYPE_CUSTOM;
+}
+
+/**
+ * @brief Function to make a descriptor findable by name.
+ * @param type The descriptor, it must outlive the registry.
+ * @return 1 if registered, 0 if the name is taken or the registry is full.
+ * Time complexity: O(n), n is the number of registered types
+ * @warning The registry is not thread safe, register the types before starting threads.
+ */
+int dsa_type_register(const dsa_type* type) {
+   assert(type->name && "Type must have a name");
+   if (dsa_type_lookup(type->name) || __dsa_type_count == DSA_TYPE_REGISTRY_CAPACITY) return 0;
+   __dsa_type_registry[__dsa_type_count++] = type;
+   return 1;
+}
+
+/**
+ * @brief Function to find a registered descriptor.
+ * @param name The name of the type, e.g. "i32".
+ * @return The descriptor, or NULL if there is none with this name.
+ * Time complexity: O(n), n is the number of registered types
+ */
+const dsa_type* dsa_type_lookup(const char* name) {
+   for (size_t i = 0; i < __dsa_type_count; i++)
+      if (strcmp(__dsa_type_registry[i]->name, name) == 0) return __dsa_type_registry[i];
+   return NULL;
+}
+
+/**
+ * @brief Function to map a primitive value to an unsigned key with the same order.
+ * @param data Pointer to the value.
+ * @param tag The primitive type.
+ * @return The key.
+ * Time complexity: O(1)
+ * @note This function is used internally by the library.
+ */
+uint64_t __typed_radix_key(void* data, dsa_type_tag tag) {
+   switch (tag) {
+      case DSA_TYPE_I8: return (uint8_t)(*(int8_t*)data) ^ 0x80;
+      case DSA_TYPE_U8: return *(uint8_t*)data;
+      case DSA_TYPE_I16: return (uint16_t)(*(int16_t*)data) ^ 0x8000;
+      case DSA_TYPE_U16: return *(uint16_t*)data;
+      case DSA_TYPE_I32: return (uint32_t)(*(int32_t*)data) ^ 0x80000000u;
+      case DSA_TYPE_U32: return *(uint32_t*)data;
+      case DSA_TYPE_I64: return (uint64_t)(*(int64_t*)data) ^ 0x8000000000000000ull;
+      case DSA_TYPE_U64: return *(uint64_t*)data;
+      case DSA_TYPE_F32: {
+         // Flipping every bit of negative floats and the sign bit of positive ones.
+         uint32_t bits;
+         memcpy(&bits, data, sizeof(bits));
+         return bits & 0x80000000u ? (uint32_t)~bits : bits | 0x80000000u;
+      }
+      case DSA_TYPE_F64: {
+         uint64_t bits;
+         memcpy(&bits, data, sizeof(bits));
+         return bits & 0x8000000000000000ull ? ~bits : bits | 0x8000000000000000ull;
+      }
+      default: assert(0 && "Type is not primitive"); return 0;
+   }
+}
+
+/**
+ * @brief Function to sort primitive values with a least significant digit radix sort.
+ * @param start The start pointer.
+ * @param end The end pointer.
+ * @param type The descriptor of a primitive type.
+ * @param allocator The allocator for the scratch buffer, NULL for malloc.
+ * Time complexity: O(n * size of the type)
+ * @note Stable. Bytes whose value is the same for every element are skipped.
+ * Floats are ordered with -0.0 before 0.0 and NaNs at the ends.
+ */
+void radix_sort(void* start, void* end, const dsa_type* type, dsa_allocator* allocator) {
+   assert(dsa_type_is_primitive(type) && "Radix sort needs a primitive type");
+   size_t es = type->size;
+   size_t n = (end - start) / es;
+   if (n <= 1) return;
+   void* temp = dsa_alloc(allocator, n * es);
+   assert(temp && "Not Enough Memory!");
+   void* src = start;
+   void* dest = temp;
+   size_t counts[256];
+   for (size_t shift = 0; shift < es * 8; shift += 8) {
+      memset(counts, 0, sizeof(counts));
+      for (size_t i = 0; i < n; i++)
+         counts[(__typed_radix_key(src + i * es, type->tag) >> shift) & 0xFF]++;
+      if (counts[(__typed_radix_key(src, type->tag) >> shift) & 0xFF] == n) continue;
+      // Turning the counts into the first position of each digit.
+      size_t position = 0;
+      for (size_t d = 0; d < 256; d++) {
+         size_t count = counts[d];
+         counts[d] = position;
+         position += count;
+      }
+      for (size_t i = 0; i < n; i++) {
+         size_t d = (__typed_radix_key(src + i * es, type->tag) >> shift) & 0xFF;
+         memcpy(dest + counts[d]++ * es, src + i * es, es);
+      }
+      void* swap_ptr = src;
+      src = dest;
+      dest = swap_ptr;
+   }
+   if (src != start) memcpy(start, src, n * es);
+   dsa_free(allocator, temp, n * es);
+}
+
+/**
+ * @brief Function to sort values using the best kernel for their type.
+ * @param start The start pointer.
+ * @param end The end pointer.
+ * @param type The descriptor of the values.
+ * @param allocator The allocator for the scratch buffer of radix_sort(), NULL for malloc.
+ * Time complexity: O(n) for primitive types, O(n log n) otherwise
+ * @note Primitive types use radix_sort() past a few dozen elements, other types sort() with `cmp`.
+ */
+void typed_sort(void* start, void* end, const dsa_type* type, dsa_allocator* allocator) {
+   size_t n = (end - start) / type->size;
+   if (dsa_type_is_primitive(type) && n > 64) {
+      radix_sort(start, end, type, allocator);
+      return;
+   }
+   assert(type->cmp && "Type has no comparator");
+   sort(start, end, type->size, type->cmp);
+}
+
+// Linear search comparing values as `ctype`.
+#define __DSA_FIND_LOOP(ctype)                                     \
+   {                                                               \
+      ctype needle = *(ctype*)value;                               \
+      for (ctype* ptr = start; (void*)ptr < end; ptr++)            \
+         if (*ptr == needle) return ptr;                           \
+      return end;                                                  \
+   }
+
+/**
+ * @brief Function to find the first value equal to a given one, using the best kernel for the type.
+ * @param start The start pointer.
+ * @param end The end pointer.
+ * @param type The descriptor of the values.
+ * @param value Pointer to the value.
+ * @return A pointer to the first equal value, or `end` if there is none.
+ * Time complexity: O(n)
+ * @note Primitive types compare native values instead of calling memcmp for each element.
+ * Floats compare with ==, so 0.0 finds -0.0.
+ */
+void* typed_find(void* start, void* end, const dsa_type* type, void* value) {
+   switch (type->tag) {
+      case DSA_TYPE_I8:
+      case DSA_TYPE_U8: __DSA_FIND_LOOP(uint8_t)
+      case DSA_TYPE_I16:
+      case DSA_TYPE_U16: __DSA_FIND_LOOP(uint16_t)
+      case DSA_TYPE_I32:
+      case DSA_TYPE_U32: __DSA_FIND_LOOP(uint32_t)
+      case DSA_TYPE_I64:
+      case DSA_TYPE_U64: __DSA_FIND_LOOP(uint64_t)
+      case DSA_TYPE_F32: __DSA_FIND_LOOP(float)
+      case DSA_TYPE_F64: __DSA_FIND_LOOP(double)
+      default: break;
+   }
+   if (type->equals) {
+      for (void* ptr = start; ptr < end; ptr += type->size)
+         if (type->equals(ptr, value)) return ptr;
+      return end;
+   }
+   if (type->cmp) {
+      for (void* ptr = start; ptr < end; ptr += type->size)
+         if (type->cmp(ptr, value) == 0) return ptr;
+      return end;
+   }
+   return find(start, end, type->size, value);
+}
+
+/**
+ * @brief Function to hash a value.
+ * @param data Pointer to the value.
+ * @param type The descriptor of the value.
+ * @return The hash.
+ * Time complexity: O(size of the type)
+ * @note Uses the hash of the descriptor if any, a 64 bit mixer for primitive types,
+ * FNV-1a over the bytes otherwise.
+ */
+size_t typed_hash(void* data, const dsa_type* type) {
+   if (type->hash) return type->hash(data);
+   if (dsa_type_is_primitive(type)) {
+      uint64_t bits = 0;
+      // Equal floats must hash the same, 0.0 and -0.0 included.
+      int zero = (type->tag == DSA_TYPE_F32 && *(float*)data == 0) ||
+                 (type->tag == DSA_TYPE_F64 && *(double*)data == 0);
+      if (!zero) memcpy(&bits, data, type->size);
+      bits ^= bits >> 30;
+      bits *= 0xBF58476D1CE4E5B9ull;
+      bits ^= bits >> 27;
+      bits *= 0x94D049BB133111EBull;
+      bits ^= bits >> 31;
+      return (size_t)bits;
+   }
+   uint64_t hash = 0xCBF29CE484222325ull;
+   for (size_t i = 0; i < type->size; i++) {
+      hash ^= ((unsigned char*)data)[i];
+      hash *= 0x100000001B3ull;
+   }
+   return (size_t)hash;
+}
+
+/**
+ * @brief Function to hash a range of values, depending on their order.
+ * @param start The start pointer.
+ * @param end The end pointer.
+ * @param type The descriptor of the values.
+ * @return The hash.
+ * Time complexity: O(n)
+ */
+size_t typed_hash_range(void* start, void* end, const dsa_type* type) {
+   size_t hash = 0;
+   for (void* ptr = start; ptr < end; ptr += type->size)
+      hash ^= typed_hash(ptr, type) + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2);
+   return hash;
+}
+
+/**
+ * @brief Function to write a range of values into a flat buffer.
+ * @param start The start pointer.
+ * @param end The end pointer.
+ * @param type The descriptor of the values.
+ * @param out The buffer, at least `end - start` bytes.
+ * @return The number of bytes written.
+ * Time complexity: O(n)
+ * @note Types without a copy function, the primitive ones included, are written with one memcpy.
+ */
+size_t typed_serialize(void* start, void* end, const dsa_type* type, void* out) {
+   size_t bytes = end - start;
+   if (type->copy == NULL) {
+      if (bytes > 0) memcpy(out, start, bytes);
+      return bytes;
+   }
+   for (size_t offset = 0; offset < bytes; offset += type->size)
+      type->copy(out + offset, start + offset);
+   return bytes;
+}
+
+#endif // c_dsa_generic_type_c
@@ -0,0 +1,79 @@
+#ifndef c_dsa_generic_type_h
+#define c_dsa_generic_type_h
+
+#include "stddef.h"
+#include "stdint.h"
+#include "../Memory/allocator.h"
+
+// Maximum number of descriptors dsa_type_register() can hold, the primitive ones included.
+#ifndef DSA_TYPE_REGISTRY_CAPACITY
+#define DSA_TYPE_REGISTRY_CAPACITY 64
+#endif
+
+/**
+ * @brief Tag telling the kernels which primitive type a descriptor stands for.
+ * @var DSA_TYPE_CUSTOM Any other type, only the functions of the descriptor are used.
+*/
+typedef enum dsa_type_tag {
+   DSA_TYPE_CUSTOM,
+   DSA_TYPE_I8,
+   DSA_TYPE_U8,
+   DSA_TYPE_I16,
+   DSA_TYPE_U16,
+   DSA_TYPE_I32,
+   DSA_TYPE_U32,
+   DSA_TYPE_I64,
+   DSA_TYPE_U64,
+   DSA_TYPE_F32,
+   DSA_TYPE_F64,
+} dsa_type_tag;
+
+/**
+ * @brief Describes the type of the elements of a container.
+ * @var const char* name The name used by dsa_type_lookup().
+ * @var size_t size The size of the type.
+ * @var size_t alignment The alignment of the type.
+ * @var dsa_type_tag tag The primitive type, or DSA_TYPE_CUSTOM.
+ * @var int (*cmp)(void*, void*) The comparator used for sorting.
+ * @var size_t (*hash)(void*) The hash function. NULL hashes the bytes.
+ * @var int (*equals)(void*, void*) The equality used for finding. NULL compares with `cmp`,
+ * or the bytes if `cmp` is NULL too.
+ * @var void (*copy)(void*, void*) Copies the second argument into the first one. NULL means
+ * the type is copied bytewise.
+ * @var void (*destroy)(void*) Releases what an element owns, used as the destroyer of the container.
+*/
+typedef struct dsa_type {
+   const char* name;
+   size_t size;
+   size_t alignment;
+   dsa_type_tag tag;
+   int (*cmp)(void*, void*);
+   size_t (*hash)(void*);
+   int (*equals)(void*, void*);
+   void (*copy)(void*, void*);
+   void (*destroy)(void*);
+} dsa_type;
+
+extern const dsa_type dsa_type_i8;
+extern const dsa_type dsa_type_u8;
+extern const dsa_type dsa_type_i16;
+extern const dsa_type dsa_type_u16;
+extern const dsa_type dsa_type_i32;
+extern const dsa_type dsa_type_u32;
+extern const dsa_type dsa_type_i64;
+extern const dsa_type dsa_type_u64;
+extern const dsa_type dsa_type_f32;
+extern const dsa_type dsa_type_f64;
+
+int dsa_type_is_primitive(const dsa_type* type);
+int dsa_type_register(const dsa_type* type);
+const dsa_type* dsa_type_lookup(const char* name);
+uint64_t __typed_radix_key(void* data, dsa_type_tag tag);
+void radix_sort(void* start, void* end, const dsa_type* type, dsa_allocator* allocator);
+void typed_sort(void* start, void* end, const dsa_type* type, dsa_allocator* allocator);
+void* typed_find(void* start, void* end, const dsa_type* type, void* value);
+size_t typed_hash(void* data, const dsa_type* type);
+size_t typed_hash_range(void* start, void* end, const dsa_type* type);
+size_t typed_serialize(void* start, void* end, const dsa_type* type, void* out);
+
+#endif // c_dsa_generic_type_h
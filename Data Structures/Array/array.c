@@ -13,7 +13,7 @@
 
 
 
-void __check_range(array* arr, void* start, void* end) {
+void __arr_check_range(array* arr, void* start, void* end) {
    assert(start >= arr->data && "Start pointer out of bounds");
    assert(end <= arr->data + arr->size * arr->element_size && "End pointer out of bounds");
    assert(start <= end && "Start pointer must be less than or equal to end pointer");
@@ -21,12 +21,25 @@ void __check_range(array* arr, void* start, void* end) {
 }
 
 array array_init_with_destroyer(size_t size, size_t element_size, void (*destroyer)(void*)) {
+   return array_init_with_allocator(size, element_size, destroyer, NULL);
+}
+
+
+/**
+ * The allocator is copied into the array and used for its data, NULL means malloc.
+*/
+array array_init_with_allocator(size_t size, size_t element_size, void (*destroyer)(void*), dsa_allocator* allocator) {
    assert(size > 0 && "Array size must be greater than 0");
    array arr;
    arr.size = size;
    arr.element_size = element_size;
-   arr.data = malloc(size * element_size);
+   arr.allocator = allocator ? *allocator : dsa_default_allocator();
+   arr.alignment = 0;
+   arr.capacity = size * element_size;
+   arr.data = dsa_alloc(&arr.allocator, arr.capacity);
+   assert(arr.data && "Not Enough Memory!");
    arr.destroyer = destroyer;
+   arr.type = NULL;
    return arr;
 }
 
@@ -36,6 +49,40 @@ array arr_init(size_t size, size_t element_size) {
 }
 
 
+/**
+ * The data is aligned to `alignment` (a power of two) and padded to a multiple of it,
+ * so SIMD kernels can run over [arr_begin, arr_padded_end) without a scalar epilogue.
+*/
+array arr_init_aligned(size_t size, size_t element_size, size_t alignment) {
+   assert(size > 0 && "Array size must be greater than 0");
+   assert(alignment > 0 && (alignment & (alignment - 1)) == 0 && "Alignment must be a power of two");
+   array arr;
+   arr.size = size;
+   arr.element_size = element_size;
+   arr.allocator = dsa_default_allocator();
+   arr.alignment = alignment;
+   arr.capacity = dsa_align_up(size * element_size, alignment);
+   arr.data = dsa_alloc_aligned(&arr.allocator, arr.capacity, alignment);
+   assert(arr.data && "Not Enough Memory!");
+   arr.destroyer = NULL;
+   arr.type = NULL;
+   return arr;
+}
+
+
+/**
+ * Uses the size, alignment and destroy function of `type`, which must outlive the array.
+ * arr_sort, arr_find, arr_hash and arr_serialize pick their kernel from the type.
+*/
+array arr_init_typed(size_t size, const dsa_type* type) {
+   array arr = type->alignment > DSA_DEFAULT_ALIGNMENT ? arr_init_aligned(size, type->size, type->alignment)
+                                                       : arr_init(size, type->size);
+   arr.destroyer = type->destroy;
+   arr.type = type;
+   return arr;
+}
+
+
 void arr_for_each_idx(array* arr, void (*callback)(void*, size_t)) {
    void* start = arr->data;
    void* end = arr->data + arr->size * arr->element_size;
@@ -49,7 +96,7 @@ void arr_for_each(array* arr, void (*callback)(void*)) {
 
 
 void arr_for_each_n_idx(array* arr, void* start, size_t n, void (*callback)(void*, size_t)) {
-   __check_range(arr, start, start + n * arr->element_size);
+   __arr_check_range(arr, start, start + n * arr->element_size);
    for_each_n_idx(start, n, arr->element_size, callback);
 }
 
@@ -60,7 +107,7 @@ void arr_for_each_n(array* arr, void* start, size_t n, void (*callback)(void*))
 
 
 void arr_for_each_rng_idx(array* arr, void* start, void* end, void (*callback)(void*, size_t)) {
-   __check_range(arr, start, end);
+   __arr_check_range(arr, start, end);
    for_each_rng_idx(start, end, arr->element_size, callback);
 }
 
@@ -83,7 +130,7 @@ void arr_map(array* arr, void (*callback)(void*)) {
 
 
 void arr_map_n_idx(array* arr, void* start, size_t n, void (*callback)(void*, size_t)) {
-   __check_range(arr, start, start + n * arr->element_size);
+   __arr_check_range(arr, start, start + n * arr->element_size);
    map_n_idx(start, n, arr->element_size, callback);
 }
 
@@ -94,7 +141,7 @@ void arr_map_n(array* arr, void* start, size_t n, void (*callback)(void*)) {
 
 
 void arr_map_rng_idx(array* arr, void* start, void* end, void (*callback)(void*, size_t)) {
-   __check_range(arr, start, end);
+   __arr_check_range(arr, start, end);
    map_rng_idx(start, end, arr->element_size, callback);
 }
 
@@ -107,19 +154,19 @@ void arr_map_rng(array* arr, void* start, void* end, void (*callback)(void*)) {
 void* arr_find(array* arr, void* data) {
    void* start = arr->data;
    void* end = arr->data + arr->size * arr->element_size;
-   return find(start, end, arr->element_size, data);
+   return arr_find_rng(arr, start, end, data);
 }
 
 
 void* arr_find_rng(array* arr, void* start, void* end, void* data) {
-   __check_range(arr, start, end);
+   __arr_check_range(arr, start, end);
+   if (arr->type) return typed_find(start, end, arr->type, data);
    return find(start, end, arr->element_size, data);
 }
 
 
 void* arr_find_n(array* arr, void* start, size_t n, void* data) {
-   __check_range(arr, start, start + n * arr->element_size);
-   return find(start, start + n * arr->element_size, arr->element_size, data);
+   return arr_find_rng(arr, start, start + n * arr->element_size, data);
 }
 
 
@@ -131,13 +178,13 @@ void* arr_find_if(array* arr, int (*predicate)(void*)) {
 
 
 void* arr_find_if_rng(array* arr, void* start, void* end, int (*predicate)(void*)) {
-   __check_range(arr, start, end);
+   __arr_check_range(arr, start, end);
    return find_if(start, end, arr->element_size, predicate);
 }
 
 
 void* arr_find_if_n(array* arr, void* start, size_t n, int (*predicate)(void*)) {
-   __check_range(arr, start, start + n * arr->element_size);
+   __arr_check_range(arr, start, start + n * arr->element_size);
    return find_if(start, start + n * arr->element_size, arr->element_size, predicate);
 }
 
@@ -150,13 +197,13 @@ void* arr_find_if_not(array* arr, int (*predicate)(void*)) {
 
 
 void* arr_find_if_not_rng(array* arr, void* start, void* end, int (*predicate)(void*)) {
-   __check_range(arr, start, end);
+   __arr_check_range(arr, start, end);
    return find_if_not(start, end, arr->element_size, predicate);
 }
 
 
 void* arr_find_if_not_n(array* arr, void* start, size_t n, int (*predicate)(void*)) {
-   __check_range(arr, start, start + n * arr->element_size);
+   __arr_check_range(arr, start, start + n * arr->element_size);
    return find_if_not(start, start + n * arr->element_size, arr->element_size, predicate);
 }
 
@@ -165,8 +212,9 @@ void _arr_destroyer(array* arr) {
    if (arr->destroyer != NULL) {
       arr_for_each(arr, arr->destroyer);
    }
-   free(arr->data);
+   dsa_free_aligned(&arr->allocator, arr->data, arr->capacity, arr->alignment);
    arr->data = NULL;
+   arr->capacity = 0;
    arr->size = 0;
    arr->element_size = 0;
    arr->destroyer = NULL;
@@ -192,6 +240,12 @@ void* arr_end(array* arr) {
 }
 
 
+// End of the data rounded up to the alignment of the array, the padding holds no element
+void* arr_padded_end(array* arr) {
+   return arr->data + dsa_align_up(arr->size * arr->element_size, arr->alignment);
+}
+
+
 void* arr_front(array* arr) {
    return arr->data;
 }
@@ -203,7 +257,7 @@ void* arr_back(array* arr) {
 
 
 void arr_fill_rng(array* arr, void* start, void* end, void* data) {
-   __check_range(arr, start, end);
+   __arr_check_range(arr, start, end);
    fill(start, end, arr->element_size, data);
 }
 
@@ -213,7 +267,7 @@ void arr_fill(array* arr, void* data) {
 }
 
 void arr_fill_n(array* arr, void* start, size_t n, void* data) {
-   __check_range(arr, start, start + n * arr->element_size);
+   __arr_check_range(arr, start, start + n * arr->element_size);
    fill_n(start, n, arr->element_size, data);
 }
 
@@ -242,12 +296,12 @@ void arr_reverse(array* arr) {
 }
 
 void arr_reverse_n(array* arr, void* start, size_t n) {
-   __check_range(arr, start, start + n * arr->element_size);
+   __arr_check_range(arr, start, start + n * arr->element_size);
    reverse(start, start + n * arr->element_size, arr->element_size);
 }
 
 void arr_reverse_rng(array* arr, void* start, void* end) {
-   __check_range(arr, start, end);
+   __arr_check_range(arr, start, end);
    reverse(start, end, arr->element_size);
 }
 
@@ -259,23 +313,41 @@ void arr_sort_cmp(array* arr, int (*cmp)(void*, void*)) {
 }
 
 void arr_sort(array* arr) {
-   arr_sort_cmp(arr, int_cmp);
+   arr_sort_rng(arr, arr->data, arr->data + arr->size * arr->element_size);
 }
 
 void arr_sort_n_cmp(array* arr, void* start, size_t n, int (*cmp)(void*, void*)) {
-   __check_range(arr, start, start + n * arr->element_size);
+   __arr_check_range(arr, start, start + n * arr->element_size);
    sort(start, start + n * arr->element_size, arr->element_size, cmp);
 }
 
 void arr_sort_n(array* arr, void* start, size_t n) {
-   arr_sort_n_cmp(arr, start, n, int_cmp);
+   arr_sort_rng(arr, start, start + n * arr->element_size);
 }
 
 void arr_sort_rng_cmp(array* arr, void* start, void* end, int (*cmp)(void*, void*)) {
-   __check_range(arr, start, end);
+   __arr_check_range(arr, start, end);
    sort(start, end, arr->element_size, cmp);
 }
 
+// Without a type descriptor the elements are compared as int.
 void arr_sort_rng(array* arr, void* start, void* end) {
+   if (arr->type) {
+      __arr_check_range(arr, start, end);
+      typed_sort(start, end, arr->type, &arr->allocator);
+      return;
+   }
    arr_sort_rng_cmp(arr, start, end, int_cmp);
 }
+
+
+size_t arr_hash(array* arr) {
+   assert(arr->type && "Array has no type descriptor");
+   return typed_hash_range(arr->data, arr->data + arr->size * arr->element_size, arr->type);
+}
+
+
+size_t arr_serialize(array* arr, void* out) {
+   assert(arr->type && "Array has no type descriptor");
+   return typed_serialize(arr->data, arr->data + arr->size * arr->element_size, arr->type, out);
+}
@@ -3,20 +3,32 @@
 
 
 #include "stddef.h"
+#include "../../Memory/allocator.h"
+#include "../../Algorithms/type.h"
 
-typedef struct {
+typedef struct array {
    size_t size;
    size_t element_size;
    void* data;
+   size_t capacity; // bytes allocated for data, kept across arr_clear
    void (*destroyer)(void*);
+   dsa_allocator allocator;
+   size_t alignment;
+   const dsa_type* type;
 } array;
 
-void __check_range(array* arr, void* start, void* end);
+void __arr_check_range(array* arr, void* start, void* end);
 
 array array_init_with_destroyer(size_t size, size_t element_size, void (*destroyer)(void*));
 
+array array_init_with_allocator(size_t size, size_t element_size, void (*destroyer)(void*), dsa_allocator* allocator);
+
 array arr_init(size_t size, size_t element_size);
 
+array arr_init_aligned(size_t size, size_t element_size, size_t alignment);
+
+array arr_init_typed(size_t size, const dsa_type* type);
+
 void arr_for_each_idx(array* arr, void (*callback)(void*, size_t));
 
 void arr_for_each(array* arr, void (*callback)(void*));
@@ -69,6 +81,8 @@ void* arr_begin(array* arr);
 
 void* arr_end(array* arr);
 
+void* arr_padded_end(array* arr);
+
 void* arr_front(array* arr);
 
 void* arr_back(array* arr);
@@ -99,6 +113,10 @@ void arr_sort_rng_cmp(array* arr, void* start, void* end, int (*cmp)(void*, void
 
 void arr_sort_rng(array* arr, void* start, void* end);
 
+size_t arr_hash(array* arr);
+
+size_t arr_serialize(array* arr, void* out);
+
 void* arr_at(array* arr, int idx);
 
 
@@ -0,0 +1,517 @@
+/**
+ * Library for a dynamic bit vector with rank and select.
+ * Author : Abinash Karmakar
+ * 2023-09-01 MIT License Version: 1.0
+ */
+
+#ifndef c_dsa_generic_bit_vector_c
+#define c_dsa_generic_bit_vector_c
+
+#include "bit_vector.h"
+
+#include "../../Memory/allocator.c"  // TODO: Remove this
+#include "assert.h"
+#include "string.h"
+
+/**
+ * @brief Factory function for creating a bit vector with a custom allocator.
+ * @param size The number of bits, all set to 0.
+ * @param allocator The allocator used for the words and the index, NULL for malloc.
+ * @return The bit vector.
+ * Time complexity: O(n / 64)
+ */
+bit_vector bv_init_with_allocator(size_t size, dsa_allocator* allocator) {
+   bit_vector bv;
+   bv.size = 0;
+   bv.capacity = 0;
+   bv.words = NULL;
+   bv.block_ranks = NULL;
+   bv.select_samples = NULL;
+   bv.ones = 0;
+   bv.indexed = 0;
+   bv.allocator = allocator ? *allocator : dsa_default_allocator();
+   bv_resize(&bv, size);
+   return bv;
+}
+
+/**
+ * @brief Factory function for creating a bit vector.
+ * @param size The number of bits, all set to 0.
+ * @return The bit vector.
+ * Time complexity: O(n / 64)
+ */
+bit_vector bv_init(size_t size) {
+   return bv_init_with_allocator(size, NULL);
+}
+
+/**
+ * @brief Function to get the number of bits.
+ * @param bv The bit vector.
+ * @return The number of bits.
+ * Time complexity: O(1)
+ */
+size_t bv_size(bit_vector* bv) {
+   return bv->size;
+}
+
+/**
+ * @brief Function to check if the bit vector has no bit.
+ * @param bv The bit vector.
+ * @return 1 if empty, 0 otherwise.
+ * Time complexity: O(1)
+ */
+int bv_empty(bit_vector* bv) {
+   return bv->size == 0;
+}
+
+/**
+ * @brief Function to get the number of words holding `size` bits.
+ * @param size The number of bits.
+ * @return The number of words.
+ * Time complexity: O(1)
+ * @note This function is used internally by the library.
+ */
+size_t __bv_word_count(size_t size) {
+   return (size + 63) / 64;
+}
+
+/**
+ * @brief Function to count the set bits of a word.
+ * @param word The word.
+ * @return The number of set bits.
+ * Time complexity: O(1)
+ * @note This function is used internally by the library.
+ */
+size_t __bv_popcount(uint64_t word) {
+#if defined(__GNUC__)
+   return __builtin_popcountll(word);
+#else
+   word = word - ((word >> 1) & 0x5555555555555555ULL);
+   word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+   word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+   return (word * 0x0101010101010101ULL) >> 56;
+#endif
+}
+
+/**
+ * @brief Function to get the index of the lowest set bit of a non zero word.
+ * @param word The word.
+ * @return The index of the bit.
+ * Time complexity: O(1)
+ * @note This function is used internally by the library.
+ */
+size_t __bv_ctz(uint64_t word) {
+#if defined(__GNUC__)
+   return __builtin_ctzll(word);
+#else
+   return __bv_popcount((word & -word) - 1);
+#endif
+}
+
+/**
+ * @brief Function to zero the bits of the last word that are past the size.
+ * @param bv The bit vector.
+ * Time complexity: O(1)
+ * @note This function is used internally by the library.
+ */
+void __bv_clear_padding(bit_vector* bv) {
+   if (bv->size % 64) bv->words[bv->size / 64] &= (1ULL << (bv->size % 64)) - 1;
+}
+
+/**
+ * @brief Function to get a bit.
+ * @param bv The bit vector.
+ * @param index The index of the bit.
+ * @return 1 if the bit is set, 0 otherwise.
+ * Time complexity: O(1)
+ */
+int bv_test(bit_vector* bv, size_t index) {
+   assert(index < bv->size && "Index out of bounds");
+   return (bv->words[index / 64] >> (index % 64)) & 1;
+}
+
+/**
+ * @brief Function to set a bit to 1.
+ * @param bv The bit vector.
+ * @param index The index of the bit.
+ * Time complexity: O(1)
+ */
+void bv_set(bit_vector* bv, size_t index) {
+   assert(index < bv->size && "Index out of bounds");
+   __bv_drop_index(bv);
+   bv->words[index / 64] |= 1ULL << (index % 64);
+}
+
+/**
+ * @brief Function to set a bit to 0.
+ * @param bv The bit vector.
+ * @param index The index of the bit.
+ * Time complexity: O(1)
+ */
+void bv_reset(bit_vector* bv, size_t index) {
+   assert(index < bv->size && "Index out of bounds");
+   __bv_drop_index(bv);
+   bv->words[index / 64] &= ~(1ULL << (index % 64));
+}
+
+/**
+ * @brief Function to invert a bit.
+ * @param bv The bit vector.
+ * @param index The index of the bit.
+ * Time complexity: O(1)
+ */
+void bv_flip(bit_vector* bv, size_t index) {
+   assert(index < bv->size && "Index out of bounds");
+   __bv_drop_index(bv);
+   bv->words[index / 64] ^= 1ULL << (index % 64);
+}
+
+/**
+ * @brief Function to set a bit to a value.
+ * @param bv The bit vector.
+ * @param index The index of the bit.
+ * @param value 0 to reset the bit, anything else to set it.
+ * Time complexity: O(1)
+ */
+void bv_assign(bit_vector* bv, size_t index, int value) {
+   if (value)
+      bv_set(bv, index);
+   else
+      bv_reset(bv, index);
+}
+
+/**
+ * @brief Function to allocate room for `size` bits.
+ * @param bv The bit vector.
+ * @param size The number of bits.
+ * Time complexity: O(n / 64)
+ * @note The capacity at least doubles, so repeated bv_push_back() calls stay amortized O(1).
+ */
+void bv_reserve(bit_vector* bv, size_t size) {
+   size_t words = __bv_word_count(size);
+   if (words <= bv->capacity) return;
+   size_t capacity = bv->capacity * 2 > words ? bv->capacity * 2 : words;
+   uint64_t* data = dsa_realloc(&bv->allocator, bv->words, bv->capacity * sizeof(uint64_t), capacity * sizeof(uint64_t));
+   assert(data && "Not Enough Memory!");
+   // Keeping every bit past the size at 0, so growing never has to clear anything.
+   memset(data + bv->capacity, 0, (capacity - bv->capacity) * sizeof(uint64_t));
+   bv->words = data;
+   bv->capacity = capacity;
+}
+
+/**
+ * @brief Function to change the number of bits.
+ * @param bv The bit vector.
+ * @param size The new number of bits, added bits are 0.
+ * Time complexity: O(n / 64)
+ */
+void bv_resize(bit_vector* bv, size_t size) {
+   __bv_drop_index(bv);
+   bv_reserve(bv, size);
+   if (size < bv->size) {
+      size_t words = __bv_word_count(size);
+      memset(bv->words + words, 0, (__bv_word_count(bv->size) - words) * sizeof(uint64_t));
+      bv->size = size;
+      __bv_clear_padding(bv);
+   }
+   bv->size = size;
+}
+
+/**
+ * @brief Function to add a bit at the end.
+ * @param bv The bit vector.
+ * @param value The value of the bit.
+ * Time complexity: O(1) amortized
+ */
+void bv_push_back(bit_vector* bv, int value) {
+   bv_resize(bv, bv->size + 1);
+   if (value) bv_set(bv, bv->size - 1);
+}
+
+/**
+ * @brief Function to remove the last bit.
+ * @param bv The bit vector.
+ * Time complexity: O(1)
+ */
+void bv_pop_back(bit_vector* bv) {
+   assert(bv->size > 0 && "Bit vector is empty");
+   bv_reset(bv, bv->size - 1);
+   bv->size--;
+}
+
+/**
+ * @brief Function to set every bit to a value.
+ * @param bv The bit vector.
+ * @param value The value.
+ * Time complexity: O(n / 64)
+ */
+void bv_fill(bit_vector* bv, int value) {
+   __bv_drop_index(bv);
+   if (bv->size == 0) return;
+   memset(bv->words, value ? 0xFF : 0, __bv_word_count(bv->size) * sizeof(uint64_t));
+   __bv_clear_padding(bv);
+}
+
+/**
+ * @brief Function to keep the bits set in both bit vectors.
+ * @param dest The bit vector to update.
+ * @param src The other bit vector, of the same size.
+ * Time complexity: O(n / 64)
+ * @note The loops below work on whole words and are vectorized by the compiler.
+ */
+void bv_and(bit_vector* dest, bit_vector* src) {
+   assert(dest->size == src->size && "Bit vectors must have the same size");
+   __bv_drop_index(dest);
+   size_t words = __bv_word_count(dest->size);
+   for (size_t i = 0; i < words; i++)
+      dest->words[i] &= src->words[i];
+}
+
+/**
+ * @brief Function to set the bits set in either bit vector.
+ * @param dest The bit vector to update.
+ * @param src The other bit vector, of the same size.
+ * Time complexity: O(n / 64)
+ */
+void bv_or(bit_vector* dest, bit_vector* src) {
+   assert(dest->size == src->size && "Bit vectors must have the same size");
+   __bv_drop_index(dest);
+   size_t words = __bv_word_count(dest->size);
+   for (size_t i = 0; i < words; i++)
+      dest->words[i] |= src->words[i];
+}
+
+/**
+ * @brief Function to keep the bits set in exactly one of the bit vectors.
+ * @param dest The bit vector to update.
+ * @param src The other bit vector, of the same size.
+ * Time complexity: O(n / 64)
+ */
+void bv_xor(bit_vector* dest, bit_vector* src) {
+   assert(dest->size == src->size && "Bit vectors must have the same size");
+   __bv_drop_index(dest);
+   size_t words = __bv_word_count(dest->size);
+   for (size_t i = 0; i < words; i++)
+      dest->words[i] ^= src->words[i];
+}
+
+/**
+ * @brief Function to clear the bits that are set in another bit vector.
+ * @param dest The bit vector to update.
+ * @param src The other bit vector, of the same size.
+ * Time complexity: O(n / 64)
+ */
+void bv_andnot(bit_vector* dest, bit_vector* src) {
+   assert(dest->size == src->size && "Bit vectors must have the same size");
+   __bv_drop_index(dest);
+   size_t words = __bv_word_count(dest->size);
+   for (size_t i = 0; i < words; i++)
+      dest->words[i] &= ~src->words[i];
+}
+
+/**
+ * @brief Function to invert every bit.
+ * @param bv The bit vector.
+ * Time complexity: O(n / 64)
+ */
+void bv_not(bit_vector* bv) {
+   __bv_drop_index(bv);
+   size_t words = __bv_word_count(bv->size);
+   for (size_t i = 0; i < words; i++)
+      bv->words[i] = ~bv->words[i];
+   __bv_clear_padding(bv);
+}
+
+/**
+ * @brief Function to count the set bits.
+ * @param bv The bit vector.
+ * @return The number of set bits.
+ * Time complexity: O(n / 64), O(1) once the index is built
+ */
+size_t bv_count(bit_vector* bv) {
+   if (bv->indexed) return bv->ones;
+   size_t count = 0;
+   size_t words = __bv_word_count(bv->size);
+   for (size_t i = 0; i < words; i++)
+      count += __bv_popcount(bv->words[i]);
+   return count;
+}
+
+/**
+ * @brief Function to find the first set bit at or after an index.
+ * @param bv The bit vector.
+ * @param from The index to start from.
+ * @return The index of the bit, or bv_size() if there is none.
+ * Time complexity: O(n / 64)
+ */
+size_t bv_find_next(bit_vector* bv, size_t from) {
+   if (from >= bv->size) return bv->size;
+   size_t words = __bv_word_count(bv->size);
+   size_t i = from / 64;
+   // Masking out the bits before `from`, then skipping zero words.
+   uint64_t word = bv->words[i] & (~0ULL << (from % 64));
+   while (word == 0) {
+      if (++i == words) return bv->size;
+      word = bv->words[i];
+   }
+   return i * 64 + __bv_ctz(word);
+}
+
+/**
+ * @brief Function to find the first set bit.
+ * @param bv The bit vector.
+ * @return The index of the bit, or bv_size() if there is none.
+ * Time complexity: O(n / 64)
+ */
+size_t bv_find_first(bit_vector* bv) {
+   return bv_find_next(bv, 0);
+}
+
+/**
+ * @brief Function to call a callback with the index of every set bit, in increasing order.
+ * @param bv The bit vector.
+ * @param callback The callback.
+ * Time complexity: O(n / 64 + number of set bits)
+ */
+void bv_for_each_set(bit_vector* bv, void (*callback)(size_t)) {
+   size_t words = __bv_word_count(bv->size);
+   for (size_t i = 0; i < words; i++) {
+      // Visiting and clearing the lowest set bit until the word is empty.
+      for (uint64_t word = bv->words[i]; word; word &= word - 1)
+         callback(i * 64 + __bv_ctz(word));
+   }
+}
+
+/**
+ * @brief Function to free the rank and select index.
+ * @param bv The bit vector.
+ * Time complexity: O(1)
+ * @note This function is used internally by the library, every modification calls it.
+ */
+void __bv_drop_index(bit_vector* bv) {
+   if (!bv->indexed) return;
+   size_t blocks = (bv->size + BV_RANK_BLOCK_BITS - 1) / BV_RANK_BLOCK_BITS;
+   size_t samples = (bv->ones + BV_SELECT_SAMPLE - 1) / BV_SELECT_SAMPLE;
+   dsa_free(&bv->allocator, bv->block_ranks, (blocks + 1) * sizeof(size_t));
+   dsa_free(&bv->allocator, bv->select_samples, samples * sizeof(size_t));
+   bv->block_ranks = NULL;
+   bv->select_samples = NULL;
+   bv->indexed = 0;
+}
+
+/**
+ * @brief Function to build the index used by bv_rank() and bv_select().
+ * @param bv The bit vector.
+ * Time complexity: O(n / 64)
+ * @note The index takes about 1/8 of the size of the bits for rank and 1/8 of the set bits for select.
+ * It is dropped by the next modification.
+ */
+void bv_build_index(bit_vector* bv) {
+   __bv_drop_index(bv);
+   size_t words = __bv_word_count(bv->size);
+   size_t blocks = (bv->size + BV_RANK_BLOCK_BITS - 1) / BV_RANK_BLOCK_BITS;
+   size_t words_per_block = BV_RANK_BLOCK_BITS / 64;
+   bv->block_ranks = dsa_alloc(&bv->allocator, (blocks + 1) * sizeof(size_t));
+   assert(bv->block_ranks && "Not Enough Memory!");
+
+   size_t ones = 0;
+   for (size_t b = 0; b < blocks; b++) {
+      bv->block_ranks[b] = ones;
+      size_t end = (b + 1) * words_per_block < words ? (b + 1) * words_per_block : words;
+      for (size_t i = b * words_per_block; i < end; i++)
+         ones += __bv_popcount(bv->words[i]);
+   }
+   bv->block_ranks[blocks] = ones;
+   bv->ones = ones;
+
+   // Sampling the block of every BV_SELECT_SAMPLE-th set bit.
+   size_t samples = (ones + BV_SELECT_SAMPLE - 1) / BV_SELECT_SAMPLE;
+   bv->select_samples = samples ? dsa_alloc(&bv->allocator, samples * sizeof(size_t)) : NULL;
+   assert((bv->select_samples || samples == 0) && "Not Enough Memory!");
+   size_t b = 0;
+   for (size_t s = 0; s < samples; s++) {
+      while (bv->block_ranks[b + 1] <= s * BV_SELECT_SAMPLE) b++;
+      bv->select_samples[s] = b;
+   }
+   bv->indexed = 1;
+}
+
+/**
+ * @brief Function to count the set bits before an index.
+ * @param bv The bit vector, with its index built.
+ * @param index The index, in the range [0, size].
+ * @return The number of set bits in [0, index).
+ * Time complexity: O(1)
+ */
+size_t bv_rank(bit_vector* bv, size_t index) {
+   assert(bv->indexed && "Index not built, call bv_build_index");
+   assert(index <= bv->size && "Index out of bounds");
+   size_t rank = bv->block_ranks[index / BV_RANK_BLOCK_BITS];
+   for (size_t i = index / BV_RANK_BLOCK_BITS * (BV_RANK_BLOCK_BITS / 64); i < index / 64; i++)
+      rank += __bv_popcount(bv->words[i]);
+   if (index % 64) rank += __bv_popcount(bv->words[index / 64] & ((1ULL << (index % 64)) - 1));
+   return rank;
+}
+
+/**
+ * @brief Function to find the k-th set bit.
+ * @param bv The bit vector, with its index built.
+ * @param k The rank of the bit, starting at 0.
+ * @return The index of the bit.
+ * Time complexity: O(log b + BV_RANK_BLOCK_BITS / 64), b is the number of rank blocks between the two
+ * select samples around k. b is O(1) when set bits are dense, but sparse set bits can spread one
+ * sample over the whole vector, up to O(log(n / BV_RANK_BLOCK_BITS)) for the binary search.
+ */
+size_t bv_select(bit_vector* bv, size_t k) {
+   assert(bv->indexed && "Index not built, call bv_build_index");
+   assert(k < bv->ones && "Rank out of bounds");
+   // The samples around k bound the blocks to search.
+   size_t s = k / BV_SELECT_SAMPLE;
+   size_t samples = (bv->ones + BV_SELECT_SAMPLE - 1) / BV_SELECT_SAMPLE;
+   size_t low = bv->select_samples[s];
+   size_t high = s + 1 < samples ? bv->select_samples[s + 1] : (bv->size - 1) / BV_RANK_BLOCK_BITS;
+   // Last block whose rank is at most k.
+   while (low < high) {
+      size_t mid = low + (high - low + 1) / 2;
+      if (bv->block_ranks[mid] <= k)
+         low = mid;
+      else
+         high = mid - 1;
+   }
+   size_t remaining = k - bv->block_ranks[low];
+   size_t i = low * (BV_RANK_BLOCK_BITS / 64);
+   for (;; i++) {
+      size_t count = __bv_popcount(bv->words[i]);
+      if (remaining < count) break;
+      remaining -= count;
+   }
+   uint64_t word = bv->words[i];
+   while (remaining--) word &= word - 1;
+   return i * 64 + __bv_ctz(word);
+}
+
+/**
+ * @brief Function to remove every bit, keeping the memory.
+ * @param bv The bit vector.
+ * Time complexity: O(n / 64)
+ */
+void bv_clear(bit_vector* bv) {
+   bv_resize(bv, 0);
+}
+
+/**
+ * @brief Function to destroy the bit vector fully.
+ * @param bv The bit vector.
+ * Time complexity: O(1)
+ */
+void bv_free(bit_vector* bv) {
+   __bv_drop_index(bv);
+   dsa_free(&bv->allocator, bv->words, bv->capacity * sizeof(uint64_t));
+   bv->words = NULL;
+   bv->capacity = 0;
+   bv->size = 0;
+}
+
+#endif // c_dsa_generic_bit_vector_c
+
+// End of 'Data Structures/Bit Vector/bit_vector.c'
@@ -0,0 +1,70 @@
+#ifndef c_dsa_generic_bit_vector_h
+#define c_dsa_generic_bit_vector_h
+
+#include "stddef.h"
+#include "stdint.h"
+#include "../../Memory/allocator.h"
+
+// Number of bits covered by each cumulative count of the rank index.
+#define BV_RANK_BLOCK_BITS 512
+// Number of set bits between two samples of the select index.
+#define BV_SELECT_SAMPLE 512
+
+/**
+ * @brief A dynamic array of bits packed in 64 bit words.
+ * @var size_t size The number of bits.
+ * @var size_t capacity The number of allocated words.
+ * @var uint64_t* words The bits, bit i is bit (i % 64) of word (i / 64). Bits past the size are 0.
+ * @var size_t* block_ranks Rank index, the number of set bits before each block of BV_RANK_BLOCK_BITS bits.
+ * @var size_t* select_samples Select index, the block of every BV_SELECT_SAMPLE-th set bit.
+ * @var size_t ones The number of set bits when the index was built.
+ * @var int indexed 1 if the rank and select index matches the bits, reset by every modification.
+ * @var dsa_allocator allocator The allocator used for the words and the index.
+*/
+typedef struct bit_vector {
+   size_t size;
+   size_t capacity;
+   uint64_t* words;
+   size_t* block_ranks;
+   size_t* select_samples;
+   size_t ones;
+   int indexed;
+   dsa_allocator allocator;
+} bit_vector;
+
+
+bit_vector bv_init_with_allocator(size_t size, dsa_allocator* allocator);
+bit_vector bv_init(size_t size);
+size_t bv_size(bit_vector* bv);
+int bv_empty(bit_vector* bv);
+size_t __bv_word_count(size_t size);
+size_t __bv_popcount(uint64_t word);
+size_t __bv_ctz(uint64_t word);
+void __bv_clear_padding(bit_vector* bv);
+int bv_test(bit_vector* bv, size_t index);
+void bv_set(bit_vector* bv, size_t index);
+void bv_reset(bit_vector* bv, size_t index);
+void bv_flip(bit_vector* bv, size_t index);
+void bv_assign(bit_vector* bv, size_t index, int value);
+void bv_reserve(bit_vector* bv, size_t size);
+void bv_resize(bit_vector* bv, size_t size);
+void bv_push_back(bit_vector* bv, int value);
+void bv_pop_back(bit_vector* bv);
+void bv_fill(bit_vector* bv, int value);
+void bv_and(bit_vector* dest, bit_vector* src);
+void bv_or(bit_vector* dest, bit_vector* src);
+void bv_xor(bit_vector* dest, bit_vector* src);
+void bv_andnot(bit_vector* dest, bit_vector* src);
+void bv_not(bit_vector* bv);
+size_t bv_count(bit_vector* bv);
+size_t bv_find_next(bit_vector* bv, size_t from);
+size_t bv_find_first(bit_vector* bv);
+void bv_for_each_set(bit_vector* bv, void (*callback)(size_t));
+void __bv_drop_index(bit_vector* bv);
+void bv_build_index(bit_vector* bv);
+size_t bv_rank(bit_vector* bv, size_t index);
+size_t bv_select(bit_vector* bv, size_t k);
+void bv_clear(bit_vector* bv);
+void bv_free(bit_vector* bv);
+
+#endif // c_dsa_generic_bit_vector_h
@@ -0,0 +1,298 @@
+/*
+*  Library file for Compact Linked List
+*  Author: Abinash Karmakar
+*  https://github.com/codeAbinash/c-dsa-generic
+*  2023-09-01 MIT License Version: 1.0
+*/
+
+#ifndef c_dsa_generic_compact_list_c
+#define c_dsa_generic_compact_list_c
+
+#include "./compact_list.h"
+#include "../Vector/vector.c" // TODO: Remove this
+#include "string.h"
+#include "assert.h"
+#include "stddef.h"
+
+
+compact_list cl_init_with_destroyer(size_t element_size, void (*destroyer)(void*)) {
+   assert(element_size > 0 && "Element size must be positive");
+   compact_list list;
+   // The element keeps its natural alignment, the next index follows it
+   size_t alignment = element_size & -element_size;
+   if (alignment > DSA_DEFAULT_ALIGNMENT) alignment = DSA_DEFAULT_ALIGNMENT;
+   if (alignment < sizeof(uint32_t)) alignment = sizeof(uint32_t);
+   list.size = 0;
+   list.element_size = element_size;
+   list.next_offset = dsa_align_up(element_size, sizeof(uint32_t));
+   list.slot_size = dsa_align_up(list.next_offset + sizeof(uint32_t), alignment);
+   list.head = CL_NIL;
+   list.tail = CL_NIL;
+   list.free_head = CL_NIL;
+   list.slots = vec_init(0, list.slot_size);
+   list.destroyer = destroyer;
+   return list;
+}
+
+
+compact_list cl_init(size_t element_size) {
+   return cl_init_with_destroyer(element_size, NULL);
+}
+
+
+void cl_reserve(compact_list* list, size_t size) {
+   vec_reserve(&list->slots, size);
+}
+
+
+size_t cl_size(compact_list* list) {
+   return list->size;
+}
+
+
+int cl_is_empty(compact_list* list) {
+   return list->size == 0;
+}
+
+
+void* _cl_slot(compact_list* list, uint32_t index) {
+   return list->slots.data + (size_t)index * list->slot_size;
+}
+
+
+uint32_t* _cl_next_of(compact_list* list, uint32_t index) {
+   return (uint32_t*)(_cl_slot(list, index) + list->next_offset);
+}
+
+
+// Freed nodes are reused first, the vector only grows when none is left
+uint32_t _cl_new_node(compact_list* list, void* data) {
+   uint32_t index = list->free_head;
+   if (index != CL_NIL) {
+      list->free_head = *_cl_next_of(list, index);
+   } else {
+      assert(list->slots.size < CL_NIL && "Compact list is full");
+      vec_emplace_back(&list->slots);
+      index = (uint32_t)(list->slots.size - 1);
+   }
+   memcpy(_cl_slot(list, index), data, list->element_size);
+   *_cl_next_of(list, index) = CL_NIL;
+   return index;
+}
+
+
+void _cl_release_node(compact_list* list, uint32_t index) {
+   if (list->destroyer) list->destroyer(_cl_slot(list, index));
+   *_cl_next_of(list, index) = list->free_head;
+   list->free_head = index;
+}
+
+
+uint32_t cl_begin(compact_list* list) {
+   return list->head;
+}
+
+
+uint32_t cl_next(compact_list* list, uint32_t index) {
+   return *_cl_next_of(list, index);
+}
+
+
+void* cl_data(compact_list* list, uint32_t index) {
+   return _cl_slot(list, index);
+}
+
+
+void* cl_front(compact_list* list) {
+   assert(list->head != CL_NIL && "List is empty");
+   return _cl_slot(list, list->head);
+}
+
+
+void* cl_back(compact_list* list) {
+   assert(list->tail != CL_NIL && "List is empty");
+   return _cl_slot(list, list->tail);
+}
+
+
+uint32_t cl_insert_after(compact_list* list, uint32_t index, void* data) {
+   uint32_t node = _cl_new_node(list, data);
+   if (index == CL_NIL) {
+      *_cl_next_of(list, node) = list->head;
+      list->head = node;
+   } else {
+      *_cl_next_of(list, node) = *_cl_next_of(list, index);
+      *_cl_next_of(list, index) = node;
+   }
+   if (*_cl_next_of(list, node) == CL_NIL)
+      list->tail = node;
+   list->size++;
+   return node;
+}
+
+
+uint32_t cl_push_front(compact_list* list, void* data) {
+   return cl_insert_after(list, CL_NIL, data);
+}
+
+
+uint32_t cl_push_back(compact_list* list, void* data) {
+   return cl_insert_after(list, list->tail, data);
+}
+
+
+void cl_erase_after(compact_list* list, uint32_t index) {
+   uint32_t* link = index == CL_NIL ? &list->head : _cl_next_of(list, index);
+   uint32_t node = *link;
+   assert(node != CL_NIL && "Cannot Delete, No Node!");
+   *link = *_cl_next_of(list, node);
+   if (list->tail == node)
+      list->tail = index;
+   list->size--;
+   _cl_release_node(list, node);
+}
+
+
+void cl_pop_front(compact_list* list) {
+   assert(list->size && "Cannot Delete, Empty List!");
+   cl_erase_after(list, CL_NIL);
+}
+
+
+void cl_pop_back(compact_list* list) {
+   assert(list->size && "Cannot Delete, Empty List!");
+   cl_erase_after(list, list->size == 1 ? CL_NIL : cl_node_at(list, list->size - 2));
+}
+
+
+uint32_t cl_node_at(compact_list* list, size_t position) {
+   assert(position < list->size && "Invalid Index");
+   if (position == list->size - 1) return list->tail;
+   uint32_t node = list->head;
+   while (position--)
+      node = *_cl_next_of(list, node);
+   return node;
+}
+
+
+void cl_insert_at(compact_list* list, void* data, size_t position) {
+   assert(position <= list->size && "Invalid Index");
+   cl_insert_after(list, position == 0 ? CL_NIL : cl_node_at(list, position - 1), data);
+}
+
+
+void cl_delete_at(compact_list* list, size_t position) {
+   assert(position < list->size && "Invalid Index");
+   cl_erase_after(list, position == 0 ? CL_NIL : cl_node_at(list, position - 1));
+}
+
+
+void* cl_data_at(compact_list* list, size_t position) {
+   return _cl_slot(list, cl_node_at(list, position));
+}
+
+
+void cl_set_at(compact_list* list, size_t position, void* data) {
+   memcpy(cl_data_at(list, position), data, list->element_size);
+}
+
+
+uint32_t cl_find(compact_list* list, void* data) {
+   for (uint32_t node = list->head; node != CL_NIL; node = *_cl_next_of(list, node))
+      if (memcmp(_cl_slot(list, node), data, list->element_size) == 0)
+         return node;
+   return CL_NIL;
+}
+
+
+int cl_contains(compact_list* list, void* data) {
+   return cl_find(list, data) != CL_NIL;
+}
+
+
+size_t cl_remove_if(compact_list* list, int (*predicate)(void*)) {
+   size_t removed = 0;
+   uint32_t prev = CL_NIL, node = list->head;
+   while (node != CL_NIL) {
+      uint32_t next = *_cl_next_of(list, node);
+      if (predicate(_cl_slot(list, node))) {
+         cl_erase_after(list, prev);
+         removed++;
+      } else
+         prev = node;
+      node = next;
+   }
+   return removed;
+}
+
+
+size_t cl_remove(compact_list* list, void* data) {
+   size_t removed = 0;
+   uint32_t prev = CL_NIL, node = list->head;
+   while (node != CL_NIL) {
+      uint32_t next = *_cl_next_of(list, node);
+      if (memcmp(_cl_slot(list, node), data, list->element_size) == 0) {
+         cl_erase_after(list, prev);
+         removed++;
+      } else
+         prev = node;
+      node = next;
+   }
+   return removed;
+}
+
+
+void cl_for_each(compact_list* list, void (*callback)(void*)) {
+   for (uint32_t node = list->head; node != CL_NIL; node = *_cl_next_of(list, node))
+      callback(_cl_slot(list, node));
+}
+
+
+void cl_for_each_idx(compact_list* list, void (*callback)(void*, size_t)) {
+   size_t i = 0;
+   for (uint32_t node = list->head; node != CL_NIL; node = *_cl_next_of(list, node))
+      callback(_cl_slot(list, node), i++);
+}
+
+
+void cl_reverse(compact_list* list) {
+   uint32_t prev = CL_NIL, node = list->head;
+   list->tail = list->head;
+   while (node != CL_NIL) {
+      uint32_t next = *_cl_next_of(list, node);
+      *_cl_next_of(list, node) = prev;
+      prev = node;
+      node = next;
+   }
+   list->head = prev;
+}
+
+
+size_t cl_serialize(compact_list* list, void* out) {
+   for (uint32_t node = list->head; node != CL_NIL; node = *_cl_next_of(list, node)) {
+      memcpy(out, _cl_slot(list, node), list->element_size);
+      out += list->element_size;
+   }
+   return list->size * list->element_size;
+}
+
+
+void cl_clear(compact_list* list) {
+   if (list->destroyer) cl_for_each(list, list->destroyer);
+   // Every node is free again, dropping the vector contents releases them all at once
+   vec_clear(&list->slots);
+   list->head = CL_NIL;
+   list->tail = CL_NIL;
+   list->free_head = CL_NIL;
+   list->size = 0;
+}
+
+
+void cl_free(compact_list* list) {
+   cl_clear(list);
+   vec_free(&list->slots);
+}
+
+#endif // c_dsa_generic_compact_list_c
+
+// End of 'Data Structures/Compact List/compact_list.c'
@@ -0,0 +1,372 @@
+/*
+*  Header file for Compact Linked List of c-dsa-generic library
+*  Author: Abinash Karmakar
+*  https://github.com/codeAbinash/c-dsa-generic
+*  2023-09-01, MIT License, Version: 1.0
+*/
+
+#ifndef c_dsa_generic_compact_list_h
+#define c_dsa_generic_compact_list_h
+
+#include "stddef.h"
+#include "stdint.h"
+#include "../Vector/vector.h"
+
+// Index standing for "no node", the end of the list or of the free list
+#define CL_NIL UINT32_MAX
+
+
+/**
+ * @brief Singly Linked List whose nodes live in one vector and link to each other by index
+ * @var size: length of the list
+ * @var element_size: size of each element in the list
+ * @var slot_size: size of a node, the element followed by the 32 bit index of the next node
+ * @var next_offset: offset of the next index in a node
+ * @var head: index of the first node, CL_NIL if the list is empty
+ * @var tail: index of the last node, CL_NIL if the list is empty
+ * @var free_head: index of the first unused node, CL_NIL if there is none
+ * @var slots: the vector holding the nodes
+ * @var destroyer: function pointer called with the data of each removed element, may be NULL
+ * @note Indices stay valid until their node is removed, but pointers to the data are invalidated
+ *       whenever the vector grows
+ * @note The links are indices, so the nodes can be copied or saved as they are
+*/
+typedef struct compact_list {
+   size_t size;
+   size_t element_size;
+   size_t slot_size;
+   size_t next_offset;
+   uint32_t head;
+   uint32_t tail;
+   uint32_t free_head;
+   vector slots;
+   void (*destroyer)(void*);
+} compact_list;
+
+
+/**
+ * @brief Factory function to create a new Compact List with a destroyer function
+ * @param element_size: size of each element in the list
+ * @param destroyer: function pointer called with the data of each removed element, may be NULL
+ * @return compact_list: a new Compact List wrapped in a struct
+ * Time Complexity: O(1)
+*/
+compact_list cl_init_with_destroyer(size_t element_size, void (*destroyer)(void*));
+
+
+/**
+ * @brief Factory function to create a new Compact List
+ * @param element_size: size of each element in the list
+ * @return compact_list: a new Compact List wrapped in a struct
+ * Time Complexity: O(1)
+*/
+compact_list cl_init(size_t element_size);
+
+
+/**
+ * @brief Reserves nodes for the given number of elements
+ * @param list: pointer to the list
+ * @param size: number of elements
+ * Time Complexity: O(n)
+*/
+void cl_reserve(compact_list* list, size_t size);
+
+
+/**
+ * @brief Function to get the length of the list
+ * @param list: pointer to the list
+ * Time Complexity: O(1)
+*/
+size_t cl_size(compact_list* list);
+
+
+/**
+ * @brief Returns 1 if the list is empty, 0 otherwise
+ * @param list: pointer to the list
+ * Time Complexity: O(1)
+*/
+int cl_is_empty(compact_list* list);
+
+
+/**
+ * @brief Returns the address of a node
+ * @param list: pointer to the list
+ * @param index: index of the node
+ * @note This function is used internally by the library
+ * Time Complexity: O(1)
+*/
+void* _cl_slot(compact_list* list, uint32_t index);
+
+
+/**
+ * @brief Returns a pointer to the next index of a node
+ * @param list: pointer to the list
+ * @param index: index of the node
+ * @note This function is used internally by the library
+ * Time Complexity: O(1)
+*/
+uint32_t* _cl_next_of(compact_list* list, uint32_t index);
+
+
+/**
+ * @brief Takes a node from the free list, or from the end of the vector
+ * @param list: pointer to the list
+ * @param data: pointer to the data, copied into the node
+ * @return uint32_t: index of the node, its next index is CL_NIL
+ * @note This function is used internally by the library
+ * Time Complexity: O(1) amortized
+*/
+uint32_t _cl_new_node(compact_list* list, void* data);
+
+
+/**
+ * @brief Destroys the data of a node and puts it on the free list
+ * @param list: pointer to the list
+ * @param index: index of the node, already unlinked
+ * @note This function is used internally by the library
+ * Time Complexity: O(1)
+*/
+void _cl_release_node(compact_list* list, uint32_t index);
+
+
+/**
+ * @brief Returns the index of the first node, CL_NIL if the list is empty
+ * @param list: pointer to the list
+ * Time Complexity: O(1)
+*/
+uint32_t cl_begin(compact_list* list);
+
+
+/**
+ * @brief Returns the index of the node after the given node, CL_NIL after the last one
+ * @param list: pointer to the list
+ * @param index: index of the node
+ * Time Complexity: O(1)
+*/
+uint32_t cl_next(compact_list* list, uint32_t index);
+
+
+/**
+ * @brief Returns the data of a node
+ * @param list: pointer to the list
+ * @param index: index of the node
+ * Time Complexity: O(1)
+*/
+void* cl_data(compact_list* list, uint32_t index);
+
+
+/**
+ * @brief Returns void pointer to the data of the first node
+ * @param list: pointer to the list
+ * Time Complexity: O(1)
+*/
+void* cl_front(compact_list* list);
+
+
+/**
+ * @brief Returns void pointer to the data of the last node
+ * @param list: pointer to the list
+ * Time Complexity: O(1)
+*/
+void* cl_back(compact_list* list);
+
+
+/**
+ * @brief Inserts a new node at the beginning of the list
+ * @param list: pointer to the list
+ * @param data: pointer to the data
+ * @return uint32_t: index of the new node
+ * @note The data will be shallow copied
+ * Time Complexity: O(1) amortized
+*/
+uint32_t cl_push_front(compact_list* list, void* data);
+
+
+/**
+ * @brief Inserts a new node at the end of the list
+ * @param list: pointer to the list
+ * @param data: pointer to the data
+ * @return uint32_t: index of the new node
+ * @note The data will be shallow copied
+ * Time Complexity: O(1) amortized
+*/
+uint32_t cl_push_back(compact_list* list, void* data);
+
+
+/**
+ * @brief Inserts a new node after the given node
+ * @param list: pointer to the list
+ * @param index: index of a node of the list, CL_NIL to insert at the beginning
+ * @param data: pointer to the data
+ * @return uint32_t: index of the new node
+ * Time Complexity: O(1) amortized
+*/
+uint32_t cl_insert_after(compact_list* list, uint32_t index, void* data);
+
+
+/**
+ * @brief Removes the node after the given node
+ * @param list: pointer to the list
+ * @param index: index of a node of the list, CL_NIL to remove the first node
+ * Time Complexity: O(1)
+*/
+void cl_erase_after(compact_list* list, uint32_t index);
+
+
+/**
+ * @brief Deletes the first node of the list
+ * @param list: pointer to the list
+ * Time Complexity: O(1)
+*/
+void cl_pop_front(compact_list* list);
+
+
+/**
+ * @brief Deletes the last node of the list
+ * @param list: pointer to the list
+ * Time Complexity: O(n)
+*/
+void cl_pop_back(compact_list* list);
+
+
+/**
+ * @brief Returns the index of the node at the given position
+ * @param list: pointer to the list
+ * @param position: position of the node in the list
+ * Time Complexity: O(n)
+*/
+uint32_t cl_node_at(compact_list* list, size_t position);
+
+
+/**
+ * @brief Inserts a new node at the given position
+ * @param list: pointer to the list
+ * @param data: pointer to the data
+ * @param position: position of the new node, at most the size of the list
+ * Time Complexity: O(n)
+*/
+void cl_insert_at(compact_list* list, void* data, size_t position);
+
+
+/**
+ * @brief Deletes the node at the given position
+ * @param list: pointer to the list
+ * @param position: position of the node
+ * Time Complexity: O(n)
+*/
+void cl_delete_at(compact_list* list, size_t position);
+
+
+/**
+ * @brief Returns the data of the node at the given position
+ * @param list: pointer to the list
+ * @param position: position of the node
+ * Time Complexity: O(n)
+*/
+void* cl_data_at(compact_list* list, size_t position);
+
+
+/**
+ * @brief Sets the data of the node at the given position
+ * @param list: pointer to the list
+ * @param position: position of the node
+ * @param data: pointer to the data
+ * @note The data will be shallow copied
+ * Time Complexity: O(n)
+*/
+void cl_set_at(compact_list* list, size_t position, void* data);
+
+
+/**
+ * @brief Returns the index of the first node whose data equals the given data, CL_NIL if none
+ * @param list: pointer to the list
+ * @param data: pointer to the data, compared with memcmp
+ * Time Complexity: O(n)
+*/
+uint32_t cl_find(compact_list* list, void* data);
+
+
+/**
+ * @brief Returns 1 if the list contains the given data, 0 otherwise
+ * @param list: pointer to the list
+ * @param data: pointer to the data, compared with memcmp
+ * Time Complexity: O(n)
+*/
+int cl_contains(compact_list* list, void* data);
+
+
+/**
+ * @brief Removes all the nodes whose data matches the predicate
+ * @param list: pointer to the list
+ * @param predicate: function pointer returning non zero for the data to remove
+ * @return size_t: number of nodes removed
+ * Time Complexity: O(n)
+*/
+size_t cl_remove_if(compact_list* list, int (*predicate)(void*));
+
+
+/**
+ * @brief Removes all the nodes whose data equals the given data
+ * @param list: pointer to the list
+ * @param data: pointer to the data, compared with memcmp
+ * @return size_t: number of nodes removed
+ * Time Complexity: O(n)
+*/
+size_t cl_remove(compact_list* list, void* data);
+
+
+/**
+ * @brief Calls the callback function with the data of each node, in list order
+ * @param list: pointer to the list
+ * @param callback: function pointer to the callback function
+ * Time Complexity: O(n)
+*/
+void cl_for_each(compact_list* list, void (*callback)(void*));
+
+
+/**
+ * @brief Calls the callback function with the data and the position of each node, in list order
+ * @param list: pointer to the list
+ * @param callback: function pointer to the callback function
+ * Time Complexity: O(n)
+*/
+void cl_for_each_idx(compact_list* list, void (*callback)(void*, size_t));
+
+
+/**
+ * @brief Reverse the list
+ * @param list: pointer to the list
+ * Time Complexity: O(n)
+*/
+void cl_reverse(compact_list* list);
+
+
+/**
+ * @brief Writes the elements in list order into a flat buffer
+ * @param list: pointer to the list
+ * @param out: the buffer, at least size * element_size bytes
+ * @return size_t: the number of bytes written
+ * Time Complexity: O(n)
+*/
+size_t cl_serialize(compact_list* list, void* out);
+
+
+/**
+ * @brief Clears the list, the nodes are kept for reuse
+ * @param list: pointer to the list
+ * @note O(1) without a destroyer, every node is released at once
+ * Time Complexity: O(n)
+*/
+void cl_clear(compact_list* list);
+
+
+/**
+ * @brief Function to free the memory of the list and all the nodes
+ * @param list: pointer to the list
+ * @note O(1) without a destroyer, the nodes are one allocation
+ * Time Complexity: O(n)
+*/
+void cl_free(compact_list* list);
+
+
+#endif // c_dsa_generic_compact_list_h
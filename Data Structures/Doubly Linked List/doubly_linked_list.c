@@ -0,0 +1,360 @@
+/*
+*  Library file for Doubly Linked List
+*  Author: Abinash Karmakar
+*  https://github.com/codeAbinash/c-dsa-generic
+*  2023-09-01 MIT License Version: 1.0
+*/
+
+#ifndef c_dsa_generic_doubly_linked_list_c
+#define c_dsa_generic_doubly_linked_list_c
+
+#include "./doubly_linked_list.h"
+#include "malloc.h"
+#include "string.h"
+#include "assert.h"
+#include "stddef.h"
+#include "../../Memory/allocator.c" // TODO: Remove this
+
+// The list whose custom destroyer is running, so that dll_node_free() can find its allocator
+static _Thread_local doubly_linked_list* __dll_destroying_list = NULL;
+
+
+doubly_linked_list dll_init_with_allocator(size_t element_size, void (*destroyer)(dll_node*), dsa_allocator* allocator) {
+   doubly_linked_list list;
+   list.size = 0;
+   list.head = NULL;
+   list.tail = NULL;
+   list.element_size = element_size;
+   list.destroyer = destroyer;
+   list.allocator = allocator ? *allocator : dsa_default_allocator();
+   return list;
+}
+
+
+doubly_linked_list dll_init_with_destroyer(size_t element_size, void (*destroyer)(dll_node*)) {
+   return dll_init_with_allocator(element_size, destroyer, NULL);
+}
+
+
+doubly_linked_list dll_init(size_t element_size) {
+   return dll_init_with_destroyer(element_size, NULL);
+}
+
+
+size_t dll_node_bytes(doubly_linked_list* list) {
+   return sizeof(dll_node) + list->element_size;
+}
+
+
+dll_node* dll_create_node(doubly_linked_list* list, void* data) {
+   dll_node* new_node = (dll_node*)dsa_alloc(&list->allocator, dll_node_bytes(list));
+   assert(new_node && "Not Enough Memory!");
+   memcpy(new_node->data, data, list->element_size);
+   new_node->prev = NULL;
+   new_node->next = NULL;
+   return new_node;
+}
+
+
+void _dll_free_node(doubly_linked_list* list, dll_node* node) {
+   dsa_free(&list->allocator, node, dll_node_bytes(list));
+}
+
+
+void dll_release_node(doubly_linked_list* list, dll_node* node) {
+   _dll_free_node(list, node);
+}
+
+
+void dll_node_free(dll_node* node) {
+   if (__dll_destroying_list) {
+      _dll_free_node(__dll_destroying_list, node);
+      return;
+   }
+   free(node);
+}
+
+
+void _dll_node_destroyer(doubly_linked_list* list, dll_node* node) {
+   if (list->destroyer) {
+      // The custom destroyer ends with dll_node_free(), which needs the allocator of this list
+      doubly_linked_list* outer = __dll_destroying_list;
+      __dll_destroying_list = list;
+      list->destroyer(node);
+      __dll_destroying_list = outer;
+   } else
+      _dll_free_node(list, node);
+}
+
+
+void _dll_unlink(doubly_linked_list* list, dll_node* node) {
+   if (node->prev) node->prev->next = node->next;
+   else list->head = node->next;
+   if (node->next) node->next->prev = node->prev;
+   else list->tail = node->prev;
+   node->prev = NULL;
+   node->next = NULL;
+   list->size--;
+}
+
+
+void _dll_link_before(doubly_linked_list* list, dll_node* pos, dll_node* node) {
+   node->next = pos;
+   node->prev = pos ? pos->prev : list->tail;
+   if (node->prev) node->prev->next = node;
+   else list->head = node;
+   if (pos) pos->prev = node;
+   else list->tail = node;
+   list->size++;
+}
+
+
+size_t dll_size(doubly_linked_list* list) {
+   return list->size;
+}
+
+
+int dll_is_empty(doubly_linked_list* list) {
+   return list->size == 0;
+}
+
+
+dll_node* dll_begin(doubly_linked_list* list) {
+   return list->head;
+}
+
+
+dll_node* dll_end(doubly_linked_list* list) {
+   return list->tail;
+}
+
+
+dll_node* dll_next(dll_node* node) {
+   return node->next;
+}
+
+
+dll_node* dll_prev(dll_node* node) {
+   return node->prev;
+}
+
+
+void* dll_front(doubly_linked_list* list) {
+   return list->head->data;
+}
+
+
+void* dll_back(doubly_linked_list* list) {
+   return list->tail->data;
+}
+
+
+void* dll_data(dll_node* node) {
+   return node->data;
+}
+
+
+void dll_push_front(doubly_linked_list* list, void* data) {
+   _dll_link_before(list, list->head, dll_create_node(list, data));
+}
+
+
+void dll_push_back(doubly_linked_list* list, void* data) {
+   _dll_link_before(list, NULL, dll_create_node(list, data));
+}
+
+
+void dll_pop_front(doubly_linked_list* list) {
+   assert(list->head && "Cannot Delete, Empty List!");
+   dll_erase(list, list->head);
+}
+
+
+// The tail knows its predecessor, no walk is needed
+void dll_pop_back(doubly_linked_list* list) {
+   assert(list->tail && "Cannot Delete, Empty List!");
+   dll_erase(list, list->tail);
+}
+
+
+dll_node* dll_insert_before(doubly_linked_list* list, dll_node* node, void* data) {
+   dll_node* new_node = dll_create_node(list, data);
+   _dll_link_before(list, node, new_node);
+   return new_node;
+}
+
+
+dll_node* dll_insert_after(doubly_linked_list* list, dll_node* node, void* data) {
+   return dll_insert_before(list, node ? node->next : list->head, data);
+}
+
+
+void dll_insert_at(doubly_linked_list* list, void* data, size_t index) {
+   assert(index <= list->size && "Index out of bounds");
+   dll_insert_before(list, index == list->size ? NULL : dll_node_at(list, index), data);
+}
+
+
+dll_node* dll_erase(doubly_linked_list* list, dll_node* node) {
+   dll_node* next = node->next;
+   _dll_unlink(list, node);
+   _dll_node_destroyer(list, node);
+   return next;
+}
+
+
+void dll_delete_at(doubly_linked_list* list, size_t index) {
+   dll_node* node = dll_node_at(list, index);
+   assert(node && "Index out of bounds");
+   dll_erase(list, node);
+}
+
+
+dll_node* dll_node_at(doubly_linked_list* list, size_t index) {
+   if (index >= list->size) return NULL;
+   dll_node* curr;
+   // Walk from whichever end is closer
+   if (index < list->size / 2) {
+      curr = list->head;
+      while (index--) curr = curr->next;
+   } else {
+      curr = list->tail;
+      for (size_t i = list->size - 1; i > index; i--) curr = curr->prev;
+   }
+   return curr;
+}
+
+
+void* dll_data_at(doubly_linked_list* list, size_t index) {
+   dll_node* node = dll_node_at(list, index);
+   assert(node && "Index out of bounds");
+   return node->data;
+}
+
+
+void dll_set_at(doubly_linked_list* list, size_t index, void* data) {
+   memcpy(dll_data_at(list, index), data, list->element_size);
+}
+
+
+dll_node* dll_find_cmp(doubly_linked_list* list, void* data, int (*cmp)(const void*, const void*, size_t)) {
+   for (dll_node* curr = list->head; curr; curr = curr->next)
+      if (cmp(curr->data, data, list->element_size) == 0)
+         return curr;
+   return NULL;
+}
+
+
+dll_node* dll_find(doubly_linked_list* list, void* data) {
+   return dll_find_cmp(list, data, memcmp);
+}
+
+
+dll_node* dll_find_last_cmp(doubly_linked_list* list, void* data, int (*cmp)(const void*, const void*, size_t)) {
+   for (dll_node* curr = list->tail; curr; curr = curr->prev)
+      if (cmp(curr->data, data, list->element_size) == 0)
+         return curr;
+   return NULL;
+}
+
+
+dll_node* dll_find_last(doubly_linked_list* list, void* data) {
+   return dll_find_last_cmp(list, data, memcmp);
+}
+
+
+int dll_contains(doubly_linked_list* list, void* data) {
+   return dll_find(list, data) != NULL;
+}
+
+
+size_t dll_index_of(doubly_linked_list* list, void* data) {
+   size_t i = 0;
+   for (dll_node* curr = list->head; curr; curr = curr->next, i++)
+      if (memcmp(curr->data, data, list->element_size) == 0)
+         return i;
+   return -1;
+}
+
+
+size_t dll_remove_cmp(doubly_linked_list* list, void* data, int (*cmp)(const void*, const void*, size_t)) {
+   size_t removed = 0;
+   dll_node* curr = list->head;
+   while (curr) {
+      if (cmp(curr->data, data, list->element_size) == 0) {
+         curr = dll_erase(list, curr);
+         removed++;
+      } else
+         curr = curr->next;
+   }
+   return removed;
+}
+
+
+size_t dll_remove(doubly_linked_list* list, void* data) {
+   return dll_remove_cmp(list, data, memcmp);
+}
+
+
+void dll_for_each(doubly_linked_list* list, void (*callback)(dll_node*)) {
+   for (dll_node* curr = list->head; curr; curr = curr->next)
+      callback(curr);
+}
+
+
+void dll_for_each_idx(doubly_linked_list* list, void (*callback)(dll_node*, size_t)) {
+   size_t i = 0;
+   for (dll_node* curr = list->head; curr; curr = curr->next)
+      callback(curr, i++);
+}
+
+
+void dll_for_each_reverse(doubly_linked_list* list, void (*callback)(dll_node*)) {
+   for (dll_node* curr = list->tail; curr; curr = curr->prev)
+      callback(curr);
+}
+
+
+void dll_reverse(doubly_linked_list* list) {
+   dll_node* curr = list->head;
+   while (curr) {
+      dll_node* next = curr->next;
+      curr->next = curr->prev;
+      curr->prev = next;
+      curr = next;
+   }
+   dll_node* head = list->head;
+   list->head = list->tail;
+   list->tail = head;
+}
+
+
+void dll_clear(doubly_linked_list* list) {
+   dll_node* curr = list->head, * next = NULL;
+   while (curr) {
+      next = curr->next;
+      _dll_node_destroyer(list, curr);
+      curr = next;
+   }
+   list->head = NULL;
+   list->tail = NULL;
+   list->size = 0;
+}
+
+
+void dll_free(doubly_linked_list* list) {
+   dll_clear(list);
+   list->element_size = 0;
+   list->destroyer = NULL;
+}
+
+
+void dll_swap(doubly_linked_list* list1, doubly_linked_list* list2) {
+   doubly_linked_list temp = *list1;
+   *list1 = *list2;
+   *list2 = temp;
+}
+
+#endif // c_dsa_generic_doubly_linked_list_c
+
+// End of 'Data Structures/Doubly Linked List/doubly_linked_list.c'
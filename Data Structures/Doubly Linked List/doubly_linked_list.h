@@ -0,0 +1,495 @@
+/*
+*  Header file for Doubly Linked List of c-dsa-generic library
+*  Author: Abinash Karmakar
+*  https://github.com/codeAbinash/c-dsa-generic
+*  2023-09-01, MIT License, Version: 1.0
+*/
+
+#ifndef c_dsa_generic_doubly_linked_list_h
+#define c_dsa_generic_doubly_linked_list_h
+
+#include "stddef.h"
+#include "../../Memory/allocator.h"
+
+
+/**
+ * @brief Node of a Doubly Linked List
+ * @var prev: pointer to the previous node
+ * @var next: pointer to the next node
+ * @var data: the data, stored inline right after the links
+ * @note A node and its data are one allocation of dll_node_bytes() bytes
+*/
+typedef struct dll_node {
+   struct dll_node* prev;
+   struct dll_node* next;
+   _Alignas(max_align_t) unsigned char data[];
+} dll_node;
+
+
+/**
+ * @brief Doubly Linked List
+ * @var size: length of the list
+ * @var head: pointer to the head node
+ * @var tail: pointer to the tail node
+ * @var element_size: size of each element in the list
+ * @var destroyer: function pointer to the destroyer function
+ * @var allocator: allocator used for the nodes
+*/
+typedef struct doubly_linked_list {
+   size_t size;
+   dll_node* head;
+   dll_node* tail;
+   size_t element_size;
+   void (*destroyer)(dll_node*);
+   dsa_allocator allocator;
+} doubly_linked_list;
+
+
+/**
+ * @brief Factory function to create a new Doubly Linked List with a custom allocator
+ * @param element_size: size of each element in the list
+ * @param destroyer: function pointer to the destroyer function, may be NULL
+ * @param allocator: allocator used for the nodes, NULL for malloc
+ * @return doubly_linked_list: a new Doubly Linked List wrapped in a struct
+ * @warning A custom destroyer should free the pointer(s) stored in the data field
+ *          and end with dll_node_free()
+ * Time Complexity: O(1)
+*/
+doubly_linked_list dll_init_with_allocator(size_t element_size, void (*destroyer)(dll_node*), dsa_allocator* allocator);
+
+
+/**
+ * @brief Factory function to create a new Doubly Linked List with a destroyer function
+ * @param element_size: size of each element in the list
+ * @param destroyer: function pointer to the destroyer function
+ * @return doubly_linked_list: a new Doubly Linked List wrapped in a struct
+ * Time Complexity: O(1)
+*/
+doubly_linked_list dll_init_with_destroyer(size_t element_size, void (*destroyer)(dll_node*));
+
+
+/**
+ * @brief Factory function to create a new Doubly Linked List
+ * @param element_size: size of each element in the list
+ * @return doubly_linked_list: a new Doubly Linked List wrapped in a struct
+ * @warning It will not free the memory of the pointer(s) that is(are) stored in the data field
+ * Time Complexity: O(1)
+*/
+doubly_linked_list dll_init(size_t element_size);
+
+
+/**
+ * @brief Returns the number of bytes allocated for a node of the list
+ * @param list: pointer to the list
+ * Time Complexity: O(1)
+*/
+size_t dll_node_bytes(doubly_linked_list* list);
+
+
+/**
+ * @brief Function to create a new unlinked node
+ * @param list: pointer to the list
+ * @param data: pointer to the data
+ * @return dll_node: pointer to the new node
+ * @note The data will be shallow copied
+ * @note Release an unlinked node with dll_release_node(), it may come from the allocator of the list
+ * Time Complexity: O(1)
+*/
+dll_node* dll_create_node(doubly_linked_list* list, void* data);
+
+
+/**
+ * @brief Function to free the memory of a node
+ * @param node: pointer to the node
+ * @note Inside a custom destroyer the node goes back to the allocator of the list being modified,
+ *       anywhere else it is released with free()
+ * @warning Outside a custom destroyer this only works for lists created without an allocator,
+ *          use dll_release_node() otherwise
+ * Time Complexity: O(1)
+*/
+void dll_node_free(dll_node* node);
+
+
+/**
+ * @brief Function to free the memory of a node created by the given list
+ * @param list: pointer to the list that created the node
+ * @param node: pointer to the node, it must not be linked in the list
+ * @note The node goes back to the allocator of the list, works for every list
+ * Time Complexity: O(1)
+*/
+void dll_release_node(doubly_linked_list* list, dll_node* node);
+
+
+/**
+ * @brief Function to free the memory of a node allocated by the given list
+ * @param list: pointer to the list that created the node
+ * @param node: pointer to the node
+ * Time Complexity: O(1)
+*/
+void _dll_free_node(doubly_linked_list* list, dll_node* node);
+
+
+/**
+ * If the destroyer function of the list is defined, it will be called
+ * Otherwise, the node is given back to the allocator of the list
+ * @param list: pointer to the list owning the node
+ * @param node: pointer to the node
+*/
+void _dll_node_destroyer(doubly_linked_list* list, dll_node* node);
+
+
+/**
+ * @brief Unlinks a node from the list without destroying it
+ * @param list: pointer to the list
+ * @param node: pointer to the node
+ * @note This function is used internally by the library
+ * Time Complexity: O(1)
+*/
+void _dll_unlink(doubly_linked_list* list, dll_node* node);
+
+
+/**
+ * @brief Links a node into the list before the given position
+ * @param list: pointer to the list
+ * @param pos: pointer to the node to link before, NULL to link at the end
+ * @param node: pointer to the node
+ * @note This function is used internally by the library
+ * Time Complexity: O(1)
+*/
+void _dll_link_before(doubly_linked_list* list, dll_node* pos, dll_node* node);
+
+
+/**
+ * @brief Function to get the length of the list
+ * @param list: pointer to the list
+ * Time Complexity: O(1)
+*/
+size_t dll_size(doubly_linked_list* list);
+
+
+/**
+ * @brief Returns 1 if the list is empty, 0 otherwise
+ * @param list: pointer to the list
+ * Time Complexity: O(1)
+*/
+int dll_is_empty(doubly_linked_list* list);
+
+
+/**
+ * @brief Returns the address of the head node
+ * @param list: pointer to the list
+ * Time Complexity: O(1)
+*/
+dll_node* dll_begin(doubly_linked_list* list);
+
+
+/**
+ * @brief Returns the address of the tail node
+ * @param list: pointer to the list
+ * Time Complexity: O(1)
+*/
+dll_node* dll_end(doubly_linked_list* list);
+
+
+/**
+ * @brief Returns the node after the given node, NULL after the tail
+ * @param node: pointer to the node
+ * Time Complexity: O(1)
+*/
+dll_node* dll_next(dll_node* node);
+
+
+/**
+ * @brief Returns the node before the given node, NULL before the head
+ * @param node: pointer to the node
+ * Time Complexity: O(1)
+*/
+dll_node* dll_prev(dll_node* node);
+
+
+/**
+ * @brief Returns void pointer to the data of the head node
+ * @param list: pointer to the list
+ * Time Complexity: O(1)
+*/
+void* dll_front(doubly_linked_list* list);
+
+
+/**
+ * @brief Returns void pointer to the data of the tail node
+ * @param list: pointer to the list
+ * Time Complexity: O(1)
+*/
+void* dll_back(doubly_linked_list* list);
+
+
+/**
+ * @brief Returns the data of the node
+ * @param node: pointer to the node
+ * Time Complexity: O(1)
+*/
+void* dll_data(dll_node* node);
+
+
+/**
+ * @brief Inserts a new node at the beginning of the list
+ * @param list: pointer to the list
+ * @param data: pointer to the data
+ * @note The data will be shallow copied
+ * Time Complexity: O(1)
+*/
+void dll_push_front(doubly_linked_list* list, void* data);
+
+
+/**
+ * @brief Inserts a new node at the end of the list
+ * @param list: pointer to the list
+ * @param data: pointer to the data
+ * @note The data will be shallow copied
+ * Time Complexity: O(1)
+*/
+void dll_push_back(doubly_linked_list* list, void* data);
+
+
+/**
+ * @brief Deletes the first node of the list
+ * @param list: pointer to the list
+ * @note internally calls dll_node_free() or the custom destroyer function
+ * Time Complexity: O(1)
+*/
+void dll_pop_front(doubly_linked_list* list);
+
+
+/**
+ * @brief Deletes the last node of the list
+ * @param list: pointer to the list
+ * @note internally calls dll_node_free() or the custom destroyer function
+ * Time Complexity: O(1)
+*/
+void dll_pop_back(doubly_linked_list* list);
+
+
+/**
+ * @brief Inserts a new node before the given node
+ * @param list: pointer to the list
+ * @param node: pointer to a node of the list, NULL to insert at the end
+ * @param data: pointer to the data
+ * @return dll_node: pointer to the new node
+ * Time Complexity: O(1)
+*/
+dll_node* dll_insert_before(doubly_linked_list* list, dll_node* node, void* data);
+
+
+/**
+ * @brief Inserts a new node after the given node
+ * @param list: pointer to the list
+ * @param node: pointer to a node of the list, NULL to insert at the beginning
+ * @param data: pointer to the data
+ * @return dll_node: pointer to the new node
+ * Time Complexity: O(1)
+*/
+dll_node* dll_insert_after(doubly_linked_list* list, dll_node* node, void* data);
+
+
+/**
+ * @brief Inserts a new node at the given index
+ * @param list: pointer to the list
+ * @param data: pointer to the data
+ * @param index: index of the new node, at most the size of the list
+ * @note Walks from the nearer end of the list
+ * Time Complexity: O(n)
+*/
+void dll_insert_at(doubly_linked_list* list, void* data, size_t index);
+
+
+/**
+ * @brief Removes a node of the list
+ * @param list: pointer to the list
+ * @param node: pointer to the node
+ * @return dll_node: pointer to the node that followed the removed one
+ * @note internally calls dll_node_free() or the custom destroyer function
+ * Time Complexity: O(1)
+*/
+dll_node* dll_erase(doubly_linked_list* list, dll_node* node);
+
+
+/**
+ * @brief Deletes the node at the given index
+ * @param list: pointer to the list
+ * @param index: index of the node to be deleted
+ * Time Complexity: O(n)
+*/
+void dll_delete_at(doubly_linked_list* list, size_t index);
+
+
+/**
+ * @brief Returns the node at the given index
+ * @param list: pointer to the list
+ * @param index: index of the node
+ * @note Returns NULL if the index is out of range, walks from the nearer end of the list
+ * Time Complexity: O(n)
+*/
+dll_node* dll_node_at(doubly_linked_list* list, size_t index);
+
+
+/**
+ * @brief Returns the data of the node at the given index
+ * @param list: pointer to the list
+ * @param index: index of the node
+ * Time Complexity: O(n)
+*/
+void* dll_data_at(doubly_linked_list* list, size_t index);
+
+
+/**
+ * @brief Sets the data of the node at the given index
+ * @param list: pointer to the list
+ * @param index: index of the node
+ * @param data: pointer to the data
+ * @note The data will be shallow copied
+ * Time Complexity: O(n)
+*/
+void dll_set_at(doubly_linked_list* list, size_t index, void* data);
+
+
+/**
+ * @brief Returns the first node that matches the given data
+ * @param list: pointer to the list
+ * @param data: pointer to the data
+ * @param cmp: function pointer to the comparator function
+ * @note The comparator function should have the following signature:
+ *    int cmp(const void*, const void*, size_t)
+ * Returns NULL if the data is not found
+ * Time Complexity: O(n)
+*/
+dll_node* dll_find_cmp(doubly_linked_list* list, void* data, int (*cmp)(const void*, const void*, size_t));
+
+
+/**
+ * @brief Returns the first node that matches the given data
+ * @note Internally calls dll_find_cmp() with memcmp as the comparator function
+ * Time Complexity: O(n)
+*/
+dll_node* dll_find(doubly_linked_list* list, void* data);
+
+
+/**
+ * @brief Returns the last node that matches the given data, searching from the tail
+ * @param list: pointer to the list
+ * @param data: pointer to the data
+ * @param cmp: function pointer to the comparator function
+ * Returns NULL if the data is not found
+ * Time Complexity: O(n)
+*/
+dll_node* dll_find_last_cmp(doubly_linked_list* list, void* data, int (*cmp)(const void*, const void*, size_t));
+
+
+/**
+ * @brief Returns the last node that matches the given data, searching from the tail
+ * @note Internally calls dll_find_last_cmp() with memcmp as the comparator function
+ * Time Complexity: O(n)
+*/
+dll_node* dll_find_last(doubly_linked_list* list, void* data);
+
+
+/**
+ * @brief Returns 1 if the list contains the given data, 0 otherwise
+ * @param list: pointer to the list
+ * @param data: pointer to the data
+ * Time Complexity: O(n)
+*/
+int dll_contains(doubly_linked_list* list, void* data);
+
+
+/**
+ * @brief Returns the index of the first node that matches the given data
+ * @param list: pointer to the list
+ * @param data: pointer to the data
+ * @note Returns -1 if the data is not found
+ * Time Complexity: O(n)
+*/
+size_t dll_index_of(doubly_linked_list* list, void* data);
+
+
+/**
+ * @brief Removes all the nodes that match the given data
+ * @param list: pointer to the list
+ * @param data: pointer to the data
+ * @param cmp: function pointer to the comparator function
+ * @return size_t: number of nodes removed
+ * @note Internally calls dll_erase(), so removing the tail is O(1)
+ * Time Complexity: O(n)
+*/
+size_t dll_remove_cmp(doubly_linked_list* list, void* data, int (*cmp)(const void*, const void*, size_t));
+
+
+/**
+ * @brief Removes all the nodes that match the given data
+ * @note Internally calls dll_remove_cmp() with memcmp as the comparator function
+ * Time Complexity: O(n)
+*/
+size_t dll_remove(doubly_linked_list* list, void* data);
+
+
+/**
+ * @brief Calls the callback function for each node in the list, from the head
+ * @param list: pointer to the list
+ * @param callback: function pointer to the callback function
+ * Time Complexity: O(n)
+*/
+void dll_for_each(doubly_linked_list* list, void (*callback)(dll_node*));
+
+
+/**
+ * @brief Calls the callback function for each node in the list and its index, from the head
+ * @param list: pointer to the list
+ * @param callback: function pointer to the callback function
+ * Time Complexity: O(n)
+*/
+void dll_for_each_idx(doubly_linked_list* list, void (*callback)(dll_node*, size_t));
+
+
+/**
+ * @brief Calls the callback function for each node in the list, from the tail
+ * @param list: pointer to the list
+ * @param callback: function pointer to the callback function
+ * Time Complexity: O(n)
+*/
+void dll_for_each_reverse(doubly_linked_list* list, void (*callback)(dll_node*));
+
+
+/**
+ * @brief Reverse the list
+ * @param list: pointer to the list
+ * Time Complexity: O(n)
+*/
+void dll_reverse(doubly_linked_list* list);
+
+
+/**
+ * @brief Clears the list
+ * @param list: pointer to the list
+ * @note Internally calls dll_node_free() or the custom destroyer function
+ * Time Complexity: O(n)
+*/
+void dll_clear(doubly_linked_list* list);
+
+
+/**
+ * @brief Function to free the memory of the list and all the nodes
+ * @param list: pointer to the list
+ * Time Complexity: O(n)
+*/
+void dll_free(doubly_linked_list* list);
+
+
+/**
+ * @brief Swaps two Doubly Linked Lists
+ * @param list1: pointer to the first list
+ * @param list2: pointer to the second list
+ * Time Complexity: O(1)
+*/
+void dll_swap(doubly_linked_list* list1, doubly_linked_list* list2);
+
+
+#endif // c_dsa_generic_doubly_linked_list_h
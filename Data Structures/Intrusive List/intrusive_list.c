@@ -0,0 +1,204 @@
+/*
+*  Library file for Intrusive Doubly Linked List
+*  Author: Abinash Karmakar
+*  https://github.com/codeAbinash/c-dsa-generic
+*  2023-09-01 MIT License Version: 1.0
+*/
+
+#ifndef c_dsa_generic_intrusive_list_c
+#define c_dsa_generic_intrusive_list_c
+
+#include "./intrusive_list.h"
+#include "assert.h"
+#include "stddef.h"
+
+
+intrusive_list il_init(void) {
+   intrusive_list list;
+   list.size = 0;
+   list.head = NULL;
+   list.tail = NULL;
+   return list;
+}
+
+
+void il_link_init(il_link* link) {
+   link->prev = NULL;
+   link->next = NULL;
+   link->owner = NULL;
+}
+
+
+int il_is_linked(il_link* link) {
+   return link->owner != NULL;
+}
+
+
+size_t il_size(intrusive_list* list) {
+   return list->size;
+}
+
+
+int il_is_empty(intrusive_list* list) {
+   return list->size == 0;
+}
+
+
+il_link* il_front(intrusive_list* list) {
+   return list->head;
+}
+
+
+il_link* il_back(intrusive_list* list) {
+   return list->tail;
+}
+
+
+il_link* il_next(il_link* link) {
+   return link->next;
+}
+
+
+il_link* il_prev(il_link* link) {
+   return link->prev;
+}
+
+
+void il_insert_before(intrusive_list* list, il_link* pos, il_link* link) {
+   assert(link->owner == NULL && "Link is already in a list");
+   link->next = pos;
+   link->prev = pos ? pos->prev : list->tail;
+   if (link->prev) link->prev->next = link;
+   else list->head = link;
+   if (pos) pos->prev = link;
+   else list->tail = link;
+   link->owner = list;
+   list->size++;
+}
+
+
+void il_insert_after(intrusive_list* list, il_link* pos, il_link* link) {
+   il_insert_before(list, pos ? pos->next : list->head, link);
+}
+
+
+void il_push_front(intrusive_list* list, il_link* link) {
+   il_insert_before(list, list->head, link);
+}
+
+
+void il_push_back(intrusive_list* list, il_link* link) {
+   il_insert_before(list, NULL, link);
+}
+
+
+il_link* il_pop_front(intrusive_list* list) {
+   assert(list->head && "Cannot Delete, Empty List!");
+   il_link* link = list->head;
+   il_remove(link);
+   return link;
+}
+
+
+il_link* il_pop_back(intrusive_list* list) {
+   assert(list->tail && "Cannot Delete, Empty List!");
+   il_link* link = list->tail;
+   il_remove(link);
+   return link;
+}
+
+
+// The link knows its list, so it can leave it without a search
+void il_remove(il_link* link) {
+   intrusive_list* list = link->owner;
+   if (list == NULL) return;
+   if (link->prev) link->prev->next = link->next;
+   else list->head = link->next;
+   if (link->next) link->next->prev = link->prev;
+   else list->tail = link->prev;
+   list->size--;
+   il_link_init(link);
+}
+
+
+size_t il_remove_if(intrusive_list* list, int (*predicate)(il_link*), void (*release)(il_link*)) {
+   size_t removed = 0;
+   il_link* curr = list->head, * next = NULL;
+   while (curr) {
+      next = curr->next;
+      if (predicate(curr)) {
+         il_remove(curr);
+         // The list is done with the link, the struct can be freed
+         if (release) release(curr);
+         removed++;
+      }
+      curr = next;
+   }
+   return removed;
+}
+
+
+il_link* il_find_if(intrusive_list* list, int (*predicate)(il_link*)) {
+   for (il_link* curr = list->head; curr; curr = curr->next)
+      if (predicate(curr))
+         return curr;
+   return NULL;
+}
+
+
+int il_contains(intrusive_list* list, il_link* link) {
+   return link->owner == list;
+}
+
+
+void il_for_each(intrusive_list* list, void (*callback)(il_link*)) {
+   il_link* curr = list->head, * next = NULL;
+   while (curr) {
+      next = curr->next;
+      callback(curr);
+      curr = next;
+   }
+}
+
+
+void il_for_each_reverse(intrusive_list* list, void (*callback)(il_link*)) {
+   il_link* curr = list->tail, * prev = NULL;
+   while (curr) {
+      prev = curr->prev;
+      callback(curr);
+      curr = prev;
+   }
+}
+
+
+void il_append_list(intrusive_list* dest, intrusive_list* src) {
+   assert(dest != src && "Lists must be different");
+   if (src->head == NULL) return;
+   for (il_link* curr = src->head; curr; curr = curr->next)
+      curr->owner = dest;
+   src->head->prev = dest->tail;
+   if (dest->tail) dest->tail->next = src->head;
+   else dest->head = src->head;
+   dest->tail = src->tail;
+   dest->size += src->size;
+   src->head = NULL;
+   src->tail = NULL;
+   src->size = 0;
+}
+
+
+void il_clear(intrusive_list* list) {
+   il_link* curr = list->head, * next = NULL;
+   while (curr) {
+      next = curr->next;
+      il_link_init(curr);
+      curr = next;
+   }
+   list->head = NULL;
+   list->tail = NULL;
+   list->size = 0;
+}
+
+#endif // c_dsa_generic_intrusive_list_c
+
+// End of 'Data Structures/Intrusive List/intrusive_list.c'
@@ -0,0 +1,258 @@
+/*
+*  Header file for Intrusive Doubly Linked List of c-dsa-generic library
+*  Author: Abinash Karmakar
+*  https://github.com/codeAbinash/c-dsa-generic
+*  2023-09-01, MIT License, Version: 1.0
+*/
+
+#ifndef c_dsa_generic_intrusive_list_h
+#define c_dsa_generic_intrusive_list_h
+
+#include "stddef.h"
+
+
+/**
+ * @brief Returns a pointer to the struct containing a link
+ * @param link: pointer to the il_link member
+ * @param type: type of the containing struct
+ * @param member: name of the il_link member in the struct
+*/
+#define IL_CONTAINER_OF(link, type, member) ((type*)((char*)(link) - offsetof(type, member)))
+
+
+struct intrusive_list;
+
+
+/**
+ * @brief Link embedded in a user struct, one per list the struct can be in at the same time
+ * @var prev: pointer to the previous link
+ * @var next: pointer to the next link
+ * @var owner: pointer to the list the link is in, NULL if it is not linked
+*/
+typedef struct il_link {
+   struct il_link* prev;
+   struct il_link* next;
+   struct intrusive_list* owner;
+} il_link;
+
+
+/**
+ * @brief Intrusive Doubly Linked List, it links user structs and never allocates or copies
+ * @var size: length of the list
+ * @var head: pointer to the first link
+ * @var tail: pointer to the last link
+ * @note The list does not own the structs, they must outlive their membership
+*/
+typedef struct intrusive_list {
+   size_t size;
+   il_link* head;
+   il_link* tail;
+} intrusive_list;
+
+
+/**
+ * @brief Factory function to create a new empty Intrusive List
+ * @return intrusive_list: a new list wrapped in a struct
+ * @warning Do not copy a list that holds links, the links point back to it
+ * Time Complexity: O(1)
+*/
+intrusive_list il_init(void);
+
+
+/**
+ * @brief Initializes a link as not linked
+ * @param link: pointer to the link
+ * Time Complexity: O(1)
+*/
+void il_link_init(il_link* link);
+
+
+/**
+ * @brief Returns 1 if the link is in a list, 0 otherwise
+ * @param link: pointer to the link
+ * Time Complexity: O(1)
+*/
+int il_is_linked(il_link* link);
+
+
+/**
+ * @brief Function to get the length of the list
+ * @param list: pointer to the list
+ * Time Complexity: O(1)
+*/
+size_t il_size(intrusive_list* list);
+
+
+/**
+ * @brief Returns 1 if the list is empty, 0 otherwise
+ * @param list: pointer to the list
+ * Time Complexity: O(1)
+*/
+int il_is_empty(intrusive_list* list);
+
+
+/**
+ * @brief Returns the first link, NULL if the list is empty
+ * @param list: pointer to the list
+ * Time Complexity: O(1)
+*/
+il_link* il_front(intrusive_list* list);
+
+
+/**
+ * @brief Returns the last link, NULL if the list is empty
+ * @param list: pointer to the list
+ * Time Complexity: O(1)
+*/
+il_link* il_back(intrusive_list* list);
+
+
+/**
+ * @brief Returns the link after the given link, NULL after the last one
+ * @param link: pointer to a linked link
+ * Time Complexity: O(1)
+*/
+il_link* il_next(il_link* link);
+
+
+/**
+ * @brief Returns the link before the given link, NULL before the first one
+ * @param link: pointer to a linked link
+ * Time Complexity: O(1)
+*/
+il_link* il_prev(il_link* link);
+
+
+/**
+ * @brief Links a link before a position
+ * @param list: pointer to the list
+ * @param pos: pointer to a link of the list, NULL to link at the end
+ * @param link: pointer to a link that is not in any list
+ * Time Complexity: O(1)
+*/
+void il_insert_before(intrusive_list* list, il_link* pos, il_link* link);
+
+
+/**
+ * @brief Links a link after a position
+ * @param list: pointer to the list
+ * @param pos: pointer to a link of the list, NULL to link at the beginning
+ * @param link: pointer to a link that is not in any list
+ * Time Complexity: O(1)
+*/
+void il_insert_after(intrusive_list* list, il_link* pos, il_link* link);
+
+
+/**
+ * @brief Links a link at the beginning of the list
+ * @param list: pointer to the list
+ * @param link: pointer to a link that is not in any list
+ * Time Complexity: O(1)
+*/
+void il_push_front(intrusive_list* list, il_link* link);
+
+
+/**
+ * @brief Links a link at the end of the list
+ * @param list: pointer to the list
+ * @param link: pointer to a link that is not in any list
+ * Time Complexity: O(1)
+*/
+void il_push_back(intrusive_list* list, il_link* link);
+
+
+/**
+ * @brief Unlinks the first link
+ * @param list: pointer to the list, not empty
+ * @return il_link: pointer to the unlinked link
+ * Time Complexity: O(1)
+*/
+il_link* il_pop_front(intrusive_list* list);
+
+
+/**
+ * @brief Unlinks the last link
+ * @param list: pointer to the list, not empty
+ * @return il_link: pointer to the unlinked link
+ * Time Complexity: O(1)
+*/
+il_link* il_pop_back(intrusive_list* list);
+
+
+/**
+ * @brief Unlinks a link from whatever list it is in
+ * @param link: pointer to the link
+ * @note Does nothing if the link is not in a list
+ * Time Complexity: O(1)
+*/
+void il_remove(il_link* link);
+
+
+/**
+ * @brief Unlinks all the links matching the predicate
+ * @param list: pointer to the list
+ * @param predicate: function pointer returning non zero for the links to unlink
+ * @param release: function pointer called with each link once unlinked, may be NULL
+ * @return size_t: number of links unlinked
+ * @note The release function may free the struct of the link
+ * Time Complexity: O(n)
+*/
+size_t il_remove_if(intrusive_list* list, int (*predicate)(il_link*), void (*release)(il_link*));
+
+
+/**
+ * @brief Returns the first link matching the predicate, NULL if there is none
+ * @param list: pointer to the list
+ * @param predicate: function pointer returning non zero for a match
+ * Time Complexity: O(n)
+*/
+il_link* il_find_if(intrusive_list* list, int (*predicate)(il_link*));
+
+
+/**
+ * @brief Returns 1 if the link is in the list, 0 otherwise
+ * @param list: pointer to the list
+ * @param link: pointer to the link
+ * Time Complexity: O(1)
+*/
+int il_contains(intrusive_list* list, il_link* link);
+
+
+/**
+ * @brief Calls the callback function for each link, from the first one
+ * @param list: pointer to the list
+ * @param callback: function pointer to the callback function
+ * @note The callback may unlink the link it is called with
+ * Time Complexity: O(n)
+*/
+void il_for_each(intrusive_list* list, void (*callback)(il_link*));
+
+
+/**
+ * @brief Calls the callback function for each link, from the last one
+ * @param list: pointer to the list
+ * @param callback: function pointer to the callback function
+ * @note The callback may unlink the link it is called with
+ * Time Complexity: O(n)
+*/
+void il_for_each_reverse(intrusive_list* list, void (*callback)(il_link*));
+
+
+/**
+ * @brief Moves all the links of src to the end of dest, src becomes empty
+ * @param dest: pointer to the destination list
+ * @param src: pointer to the source list
+ * Time Complexity: O(m) to update the owner of the moved links
+*/
+void il_append_list(intrusive_list* dest, intrusive_list* src);
+
+
+/**
+ * @brief Unlinks every link, the structs are left untouched
+ * @param list: pointer to the list
+ * Time Complexity: O(n)
+*/
+void il_clear(intrusive_list* list);
+
+
+#endif // c_dsa_generic_intrusive_list_h
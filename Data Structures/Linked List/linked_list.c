@@ -10,30 +10,235 @@
 #include "string.h"
 #include "assert.h"
 #include "stddef.h"
+#include "../../Memory/allocator.c" // TODO: Remove this
+#include "../../Algorithms/algorithms.c" // TODO: Remove this
 
+// The list whose custom destroyer is running, so that ll_node_free() can find its allocator
+static _Thread_local linked_list* __ll_destroying_list = NULL;
 
 
 linked_list ll_init_with_destroyer(size_t element_size, void (*destroyer)(ll_node*)) {
+   return ll_init_with_allocator(element_size, destroyer, NULL);
+}
+
+
+linked_list ll_init_with_allocator(size_t element_size, void (*destroyer)(ll_node*), dsa_allocator* allocator) {
    linked_list list;
    list.size = 0;
    list.head = NULL;
    list.tail = NULL;
    list.element_size = element_size;
    list.destroyer = destroyer;
+   list.allocator = allocator ? *allocator : dsa_default_allocator();
+   list.pool = NULL;
+   list.owns_pool = 0;
+   list.cached_node = NULL;
+   list.cached_index = 0;
+   list.compact_threshold = 0;
+   list.compact_countdown = 0;
+   return list;
+}
+
+
+linked_list ll_init_pooled(size_t element_size, size_t slab_nodes) {
+   linked_list list = ll_init(element_size);
+   list.pool = (ll_pool*)dsa_alloc(&list.allocator, sizeof(ll_pool));
+   assert(list.pool && "Not Enough Memory!");
+   *list.pool = ll_pool_init(element_size, slab_nodes, &list.allocator);
+   list.owns_pool = 1;
+   return list;
+}
+
+
+linked_list ll_init_with_pool(size_t element_size, void (*destroyer)(ll_node*), ll_pool* pool) {
+   assert(pool->node_size >= sizeof(ll_node) + element_size && "Pool nodes are too small");
+   linked_list list = ll_init_with_allocator(element_size, destroyer, &pool->allocator);
+   list.pool = pool;
    return list;
 }
 
 
+ll_pool ll_pool_init(size_t element_size, size_t slab_nodes, dsa_allocator* allocator) {
+   ll_pool pool;
+   pool.node_size = dsa_align_up(sizeof(ll_node) + element_size, DSA_DEFAULT_ALIGNMENT);
+   pool.slab_nodes = slab_nodes ? slab_nodes : LL_POOL_DEFAULT_SLAB_NODES;
+   pool.slab_count = 0;
+   pool.live = 0;
+   pool.free_list = NULL;
+   pool.slabs = NULL;
+   pool.current = NULL;
+   pool.used = 0;
+   pool.allocator = allocator ? *allocator : dsa_default_allocator();
+   return pool;
+}
+
+
+size_t __ll_pool_slab_bytes(ll_pool* pool) {
+   return sizeof(ll_pool_slab) + pool->slab_nodes * pool->node_size;
+}
+
+
+ll_node* ll_pool_acquire(ll_pool* pool) {
+   ll_node* node = pool->free_list;
+   if (node) {
+      pool->free_list = node->next;
+      pool->live++;
+      return node;
+   }
+   if (pool->current == NULL || pool->used == pool->slab_nodes) {
+      // Move to the next slab, slabs kept by ll_pool_reset() are reused before allocating
+      ll_pool_slab* next = pool->current ? pool->current->next : pool->slabs;
+      if (next == NULL) {
+         next = (ll_pool_slab*)dsa_alloc(&pool->allocator, __ll_pool_slab_bytes(pool));
+         assert(next && "Not Enough Memory!");
+         next->next = NULL;
+         if (pool->current) pool->current->next = next;
+         else pool->slabs = next;
+         pool->slab_count++;
+      }
+      pool->current = next;
+      pool->used = 0;
+   }
+   node = (ll_node*)((char*)pool->current->nodes + pool->used++ * pool->node_size);
+   pool->live++;
+   return node;
+}
+
+
+void ll_pool_release(ll_pool* pool, ll_node* node) {
+   node->next = pool->free_list;
+   pool->free_list = node;
+   pool->live--;
+}
+
+
+void ll_pool_reset(ll_pool* pool) {
+   pool->free_list = NULL;
+   pool->current = NULL;
+   pool->used = 0;
+   pool->live = 0;
+}
+
+
+ll_pool_stats ll_pool_get_stats(ll_pool* pool) {
+   ll_pool_stats stats;
+   stats.slabs = pool->slab_count;
+   stats.capacity = pool->slab_count * pool->slab_nodes;
+   stats.live = pool->live;
+   stats.free = stats.capacity - stats.live;
+   stats.bytes = pool->slab_count * __ll_pool_slab_bytes(pool);
+   return stats;
+}
+
+
+void ll_pool_free(ll_pool* pool) {
+   ll_pool_slab* slab = pool->slabs;
+   while (slab) {
+      ll_pool_slab* next = slab->next;
+      dsa_free(&pool->allocator, slab, __ll_pool_slab_bytes(pool));
+      slab = next;
+   }
+   pool->slabs = NULL;
+   pool->slab_count = 0;
+   ll_pool_reset(pool);
+}
+
+
+ll_pool_stats ll_get_pool_stats(linked_list* list) {
+   if (list->pool) return ll_pool_get_stats(list->pool);
+   ll_pool_stats stats = { 0 };
+   return stats;
+}
+
+
+double ll_fragmentation(linked_list* list) {
+   if (list->size < 2) return 0;
+   size_t near = ll_node_bytes(list) + LL_COMPACT_NEAR_BYTES, jumps = 0;
+   for (ll_node* curr = list->head; curr->next; curr = curr->next) {
+      char* from = (char*)curr, * to = (char*)curr->next;
+      if (to <= from || (size_t)(to - from) > near)
+         jumps++;
+   }
+   return (double)jumps / (list->size - 1);
+}
+
+
+ll_compact_stats ll_compact(linked_list* list) {
+   ll_compact_stats stats;
+   stats.bytes_moved = 0;
+   stats.fragmentation_before = ll_fragmentation(list);
+   stats.fragmentation_after = stats.fragmentation_before;
+   list->compact_countdown = list->size;
+   if (list->size == 0 || (list->pool && !list->owns_pool))
+      return stats;
+   // One slab large enough for every node, later slabs keep the same size
+   size_t slab_nodes = list->pool ? list->pool->slab_nodes : LL_POOL_DEFAULT_SLAB_NODES;
+   if (slab_nodes < list->size) slab_nodes = list->size;
+   ll_pool* pool = (ll_pool*)dsa_alloc(&list->allocator, sizeof(ll_pool));
+   assert(pool && "Not Enough Memory!");
+   *pool = ll_pool_init(list->element_size, slab_nodes, &list->allocator);
+   // Copy the nodes in list order, the old ones are freed without running the destroyer
+   ll_node* head = NULL, * tail = NULL;
+   for (ll_node* curr = list->head, * next; curr; curr = next) {
+      next = curr->next;
+      ll_node* node = ll_pool_acquire(pool);
+      memcpy(node->data, curr->data, list->element_size);
+      node->next = NULL;
+      if (tail) tail->next = node;
+      else head = node;
+      tail = node;
+      if (list->pool == NULL)
+         dsa_free(&list->allocator, curr, ll_node_bytes(list));
+   }
+   if (list->pool) {
+      ll_pool_free(list->pool);
+      dsa_free(&list->allocator, list->pool, sizeof(ll_pool));
+   }
+   list->pool = pool;
+   list->owns_pool = 1;
+   list->head = head;
+   list->tail = tail;
+   _ll_forget_position(list);
+   stats.bytes_moved = list->size * list->element_size;
+   stats.fragmentation_after = ll_fragmentation(list);
+   return stats;
+}
+
+
+void ll_set_auto_compact(linked_list* list, double threshold) {
+   list->compact_threshold = threshold;
+   list->compact_countdown = list->size;
+}
+
+
+void _ll_maybe_compact(linked_list* list) {
+   if (list->compact_threshold <= 0) return;
+   if (list->compact_countdown > 0) {
+      list->compact_countdown--;
+      return;
+   }
+   // Checking is O(n), doing it once every size changes keeps it O(1) amortized
+   list->compact_countdown = list->size;
+   if (ll_fragmentation(list) > list->compact_threshold)
+      ll_compact(list);
+}
+
+
 linked_list ll_init(size_t element_size) {
    return ll_init_with_destroyer(element_size, NULL);
 }
 
 
+size_t ll_node_bytes(linked_list* list) {
+   return sizeof(ll_node) + list->element_size;
+}
+
+
+// One allocation per node, the data lives right after the next pointer
 ll_node* ll_create_node(linked_list* list, void* data) {
-   ll_node* new_node = (ll_node*)malloc(sizeof(ll_node));
+   ll_node* new_node = list->pool ? ll_pool_acquire(list->pool)
+                                  : (ll_node*)dsa_alloc(&list->allocator, ll_node_bytes(list));
    assert(new_node && "Not Enough Memory!");
-   new_node->data = malloc(list->element_size);
-   assert(new_node->data && "Not Enough Memory!");
    memcpy(new_node->data, data, list->element_size);
    new_node->next = NULL;
    return new_node;
@@ -45,10 +250,27 @@ size_t ll_size(linked_list* list) {
 }
 
 
+void _ll_free_node(linked_list* list, ll_node* node) {
+   if (list->pool) {
+      ll_pool_release(list->pool, node);
+      return;
+   }
+   dsa_free(&list->allocator, node, ll_node_bytes(list)); // The data is freed with the node
+}
+
+
+void ll_release_node(linked_list* list, ll_node* node) {
+   _ll_free_node(list, node);
+}
+
+
 // For Destroying only one node
 void ll_node_destroyer(ll_node* node) {
-   free(node->data); // Free the data that is allocated when creating the node
-   free(node); // Free the node itself
+   if (__ll_destroying_list) {
+      _ll_free_node(__ll_destroying_list, node);
+      return;
+   }
+   free(node); // The data is freed with the node
 };
 
 
@@ -82,11 +304,15 @@ void* ll_back(linked_list* list) {
 
 
 
-void _ll_node_destroyer(void (*destroyer)(ll_node*), ll_node* node) {
-   if (destroyer)
-      destroyer(node);
-   else
-      ll_node_destroyer(node);
+void _ll_node_destroyer(linked_list* list, ll_node* node) {
+   if (list->destroyer) {
+      // The custom destroyer ends with ll_node_free(), which needs the allocator of this list
+      linked_list* outer = __ll_destroying_list;
+      __ll_destroying_list = list;
+      list->destroyer(node);
+      __ll_destroying_list = outer;
+   } else
+      _ll_free_node(list, node);
 }
 
 
@@ -97,10 +323,18 @@ void ll_destroyer(linked_list* list) {
    while (curr) {
       next = curr->next;
       // Destroy each node
-      _ll_node_destroyer(list->destroyer, curr);
+      _ll_node_destroyer(list, curr);
       curr = next;
    }
+   if (list->owns_pool) {
+      ll_pool_free(list->pool);
+      dsa_free(&list->allocator, list->pool, sizeof(ll_pool));
+   }
    // Reset the list
+   list->pool = NULL;
+   list->owns_pool = 0;
+   list->cached_node = NULL;
+   list->compact_threshold = 0;
    list->head = NULL;
    list->tail = NULL;
    list->size = 0;
@@ -144,6 +378,8 @@ void ll_push_front(linked_list* list, void* data) {
    if (list->tail == NULL)
       list->tail = new_node;
    list->size++;
+   // Every index moved one step back
+   if (list->cached_node) list->cached_index++;
 }
 
 
@@ -151,11 +387,13 @@ void ll_push_front(linked_list* list, void* data) {
 void ll_pop_front(linked_list* list) {
    assert(list->head && "Cannot Delete, Empty List!");
    ll_node* oldHead = list->head;
+   if (list->cached_node == oldHead) _ll_forget_position(list);
+   else if (list->cached_node) list->cached_index--;
    list->head = list->head->next;
    // If the list is empty after deleting the head, the tail should be NULL
    if (list->head == NULL)
       list->tail = NULL;
-   _ll_node_destroyer(list->destroyer, oldHead);
+   _ll_node_destroyer(list, oldHead);
    list->size--;
 }
 
@@ -180,21 +418,19 @@ void ll_push_back(linked_list* list, void* data) {
 // Deletion at the end
 void ll_pop_back(linked_list* list) {
    assert(list->size && "Cannot Delete, Empty List!");
-   ll_node* curr = list->head, * prev = NULL;
+   ll_node* curr = list->tail, * prev = NULL;
    // If there is only one item in the list
    if (list->head == list->tail) {
+      _ll_forget_position(list);
       list->head = NULL;
       list->tail = NULL;
       list->size = 0;
-      _ll_node_destroyer(list->destroyer, curr);
+      _ll_node_destroyer(list, curr);
       return;
    }
-   // Find the last node
-   while (curr->next) {
-      prev = curr;
-      curr = curr->next;
-   }
-   _ll_node_destroyer(list->destroyer, curr);
+   // Find the node before the last one, starting from the cached position when possible
+   prev = ll_node_at(list, list->size - 2);
+   _ll_node_destroyer(list, curr);
    // Set the new tail
    list->tail = prev;
    list->tail->next = NULL;
@@ -205,59 +441,54 @@ void ll_pop_back(linked_list* list) {
 // Deletion at a given index
 void ll_delete_at(linked_list* list, size_t index) {
    size_t size = list->size;
-   ll_node* curr = list->head, * nextNode = NULL;
-   size_t i = 1;
+   ll_node* curr, * nextNode = NULL;
    // Delete at beginning, shift
    if (index == 0) {
       ll_pop_front(list);
-      return;
-   }
-   // Delete at end, pop
-   if (index == size - 1) {
-      ll_pop_back(list);
+      _ll_maybe_compact(list);
       return;
    }
    // Invalid Index
    assert(size > index && "Invalid Index");
-   // Delete in between, find the node at index - 1
-   while (i < index) {
-      curr = curr->next;
-      i++;
-   }
+   // Find the node at index - 1, it stays cached for the next indexed call
+   curr = ll_node_at(list, index - 1);
    nextNode = curr->next->next;
+   if (curr->next == list->tail)
+      list->tail = curr;
    // If there is a destroyer function, call it
-   _ll_node_destroyer(list->destroyer, curr->next);
+   _ll_node_destroyer(list, curr->next);
    curr->next = nextNode;
    list->size--;
+   _ll_maybe_compact(list);
 }
 
 
 // Insertion at a given index
 void ll_insert_at(linked_list* list, void* data, size_t index) {
    size_t size = list->size;
-   ll_node* new_node, * curr_node = list->head;
-   size_t i = 1;
+   ll_node* new_node, * curr_node;
    // Insert at beginning, unshift
    if (index == 0) {
       ll_push_front(list, data);
+      _ll_maybe_compact(list);
       return;
    }
    // Insert at end, push
    if (index == size) {
       ll_push_back(list, data);
+      _ll_maybe_compact(list);
       return;
    }
    // Invalid Index
    assert(size > index && "Invalid Index");
    // Insert in between, find the node at index - 1
+   curr_node = ll_node_at(list, index - 1);
    new_node = ll_create_node(list, data);
-   while (i < index) {
-      curr_node = curr_node->next;
-      i++;
-   }
    new_node->next = curr_node->next;
    curr_node->next = new_node;
    list->size++;
+   _ll_remember_position(list, new_node, index);
+   _ll_maybe_compact(list);
 }
 
 
@@ -267,28 +498,14 @@ int ll_node_cmp(ll_node* node1, ll_node* node2, size_t size) {
 
 
 // Remove all the occurrences of a given data
+// Single pass, the cursor keeps the previous node so every removal is O(1)
 void ll_remove_cmp(linked_list* list, void* data, int (*cmp)(const void*, const void*, size_t)) {
-   ll_node* curr = list->head, * prev = NULL, * next = NULL;
-   while (curr) {
-      next = curr->next;
-      if (cmp(curr->data, data, list->element_size) == 0) {
-         if (prev == NULL) {
-            ll_pop_front(list);
-            curr = list->head;
-            continue;
-         } else if (next == NULL) {
-            ll_pop_back(list);
-            curr = list->tail;
-            continue;
-         } else {
-            prev->next = next;
-            _ll_node_destroyer(list->destroyer, curr);
-            list->size--;
-            curr = prev;
-         }
-      }
-      prev = curr;
-      curr = next;
+   ll_cursor cursor = ll_cursor_begin(list);
+   while (!ll_cursor_is_end(&cursor)) {
+      if (cmp(cursor.node->data, data, list->element_size) == 0)
+         ll_cursor_erase(&cursor);
+      else
+         ll_cursor_next(&cursor);
    }
 }
 
@@ -299,27 +516,13 @@ void ll_remove(linked_list* list, void* data) {
 
 
 void ll_remove_node(linked_list* list, ll_node* node) {
-   ll_node* curr = list->head, * prev = NULL, * next = NULL;
-   while (curr) {
-      next = curr->next;
-      if (curr == node) {
-         if (prev == NULL) {
-            ll_pop_front(list);
-            curr = list->head;
-            continue;
-         } else if (next == NULL) {
-            ll_pop_back(list);
-            curr = list->tail;
-            continue;
-         } else {
-            prev->next = next;
-            _ll_node_destroyer(list->destroyer, curr);
-            list->size--;
-            curr = prev;
-         }
+   ll_cursor cursor = ll_cursor_begin(list);
+   while (!ll_cursor_is_end(&cursor)) {
+      if (cursor.node == node) {
+         ll_cursor_erase(&cursor);
+         return;
       }
-      prev = curr;
-      curr = next;
+      ll_cursor_next(&cursor);
    }
 }
 
@@ -332,9 +535,10 @@ void ll_set_node_data(ll_node* node, void* data, size_t size) {
 // Deletes all the nodes after a given node
 void ll_erase_after(linked_list* list, ll_node* node) {
    ll_node* curr = node->next, * next = NULL;
+   _ll_forget_position(list);
    while (curr) {
       next = curr->next;
-      _ll_node_destroyer(list->destroyer, curr);
+      _ll_node_destroyer(list, curr);
       curr = next;
       list->size--;
    }
@@ -344,31 +548,44 @@ void ll_erase_after(linked_list* list, ll_node* node) {
 
 
 void ll_erase_after_index(linked_list* list, size_t index) {
-   ll_node* curr = list->head, * next = NULL;
-   size_t i = 0;
    // Invalid Index
    assert(list->size > index && "Invalid Index");
-   // Find the node at index
-   while (i < index) {
-      curr = curr->next;
-      i++;
-   }
-   ll_erase_after(list, curr);
+   ll_erase_after(list, ll_node_at(list, index));
 }
 
 
 // Get the node at a given index
+void _ll_forget_position(linked_list* list) {
+   list->cached_node = NULL;
+   list->cached_index = 0;
+}
+
+
+void _ll_remember_position(linked_list* list, ll_node* node, size_t index) {
+   list->cached_node = node;
+   list->cached_index = index;
+}
+
+
 ll_node* ll_node_at(linked_list* list, size_t index) {
    size_t size = list->size;
    ll_node* curr = list->head;
    size_t i = 0;
    // Invalid Index
    assert(size > index && "Invalid Index");
+   if (index == size - 1)
+      return list->tail;
+   // Resume from the last accessed node when it is not past the index
+   if (list->cached_node && list->cached_index <= index) {
+      curr = list->cached_node;
+      i = list->cached_index;
+   }
    // Find the node at index
    while (i < index) {
       curr = curr->next;
       i++;
    }
+   _ll_remember_position(list, curr, index);
    return curr;
 }
 
@@ -431,7 +648,7 @@ void ll_set_at(linked_list* list, size_t index, void* data) {
    // FInd the node at index
    ll_node* node = ll_node_at(list, index);
    // Copy the data to the node
-   memcpy(node->data, data, sizeof(data));
+   memcpy(node->data, data, list->element_size);
 }
 
 
@@ -497,6 +714,7 @@ void ll_swap(linked_list* list1, linked_list* list2) {
 
 void ll_reverse(linked_list* list) {
    ll_node* prev = NULL, * curr = list->head, * next = NULL;
+   _ll_forget_position(list);
    list->tail = list->head;
    while (curr) {
       next = curr->next;
@@ -509,16 +727,304 @@ void ll_reverse(linked_list* list) {
 
 
 
+ll_node* _ll_split(ll_node* node, size_t n) {
+   while (node && --n)
+      node = node->next;
+   if (node == NULL) return NULL;
+   ll_node* rest = node->next;
+   node->next = NULL;
+   return rest;
+}
+
+
+ll_node* _ll_merge_runs(ll_node* left, ll_node* right, int (*cmp)(void*, void*), ll_node** tail) {
+   ll_node* head = NULL, * last = NULL, * next;
+   while (left && right) {
+      // Taking from the left on ties keeps the sort stable
+      if (cmp(right->data, left->data) < 0) {
+         next = right;
+         right = right->next;
+      } else {
+         next = left;
+         left = left->next;
+      }
+      if (last) last->next = next;
+      else head = next;
+      last = next;
+   }
+   next = left ? left : right;
+   if (last) last->next = next;
+   else head = next;
+   if (next) last = next;
+   while (last && last->next) last = last->next;
+   *tail = last;
+   return head;
+}
+
+
+// Bottom up merge sort, runs of width 1, 2, 4, ... are merged by relinking the nodes
+void ll_sort_cmp(linked_list* list, int (*cmp)(void*, void*)) {
+   if (list->size < 2) return;
+   _ll_forget_position(list);
+   for (size_t width = 1; width < list->size; width *= 2) {
+      ll_node* remaining = list->head;
+      ll_node* head = NULL, * tail = NULL;
+      while (remaining) {
+         ll_node* left = remaining;
+         ll_node* right = _ll_split(left, width);
+         remaining = _ll_split(right, width);
+         ll_node* run_tail;
+         ll_node* run = _ll_merge_runs(left, right, cmp, &run_tail);
+         if (tail) tail->next = run;
+         else head = run;
+         tail = run_tail;
+      }
+      list->head = head;
+      list->tail = tail;
+   }
+}
+
+
+void ll_sort(linked_list* list) {
+   ll_sort_cmp(list, int_cmp);
+}
+
+
+
+ll_cursor ll_cursor_begin(linked_list* list) {
+   ll_cursor cursor;
+   cursor.list = list;
+   cursor.prev = NULL;
+   cursor.node = list->head;
+   cursor.index = 0;
+   return cursor;
+}
+
+
+ll_cursor ll_cursor_at(linked_list* list, size_t index) {
+   assert(index <= list->size && "Invalid Index");
+   if (index == 0) return ll_cursor_begin(list);
+   ll_cursor cursor;
+   cursor.list = list;
+   cursor.prev = ll_node_at(list, index - 1);
+   cursor.node = cursor.prev->next;
+   cursor.index = index;
+   return cursor;
+}
+
+
+int ll_cursor_is_end(ll_cursor* cursor) {
+   return cursor->node == NULL;
+}
+
+
+void ll_cursor_next(ll_cursor* cursor) {
+   assert(cursor->node && "Cursor is at the end");
+   cursor->prev = cursor->node;
+   cursor->node = cursor->node->next;
+   cursor->index++;
+}
+
+
+void* ll_cursor_data(ll_cursor* cursor) {
+   assert(cursor->node && "Cursor is at the end");
+   return cursor->node->data;
+}
+
+
+void ll_cursor_set(ll_cursor* cursor, void* data) {
+   memcpy(ll_cursor_data(cursor), data, cursor->list->element_size);
+}
+
+
+// The list keeps the position of the cursor, so indexed calls after the edit resume from it
+void _ll_cursor_sync(ll_cursor* cursor) {
+   if (cursor->prev) _ll_remember_position(cursor->list, cursor->prev, cursor->index - 1);
+   else _ll_forget_position(cursor->list);
+}
+
+
+void ll_cursor_insert_before(ll_cursor* cursor, void* data) {
+   linked_list* list = cursor->list;
+   ll_node* new_node = ll_create_node(list, data);
+   new_node->next = cursor->node;
+   if (cursor->prev) cursor->prev->next = new_node;
+   else list->head = new_node;
+   if (cursor->node == NULL) list->tail = new_node;
+   list->size++;
+   cursor->prev = new_node;
+   cursor->index++;
+   _ll_cursor_sync(cursor);
+}
+
+
+void ll_cursor_insert_after(ll_cursor* cursor, void* data) {
+   assert(cursor->node && "Cursor is at the end");
+   linked_list* list = cursor->list;
+   ll_node* new_node = ll_create_node(list, data);
+   new_node->next = cursor->node->next;
+   cursor->node->next = new_node;
+   if (list->tail == cursor->node) list->tail = new_node;
+   list->size++;
+   _ll_cursor_sync(cursor);
+}
+
+
+void ll_cursor_erase(ll_cursor* cursor) {
+   assert(cursor->node && "Cursor is at the end");
+   linked_list* list = cursor->list;
+   ll_node* node = cursor->node;
+   cursor->node = node->next;
+   if (cursor->prev) cursor->prev->next = node->next;
+   else list->head = node->next;
+   if (list->tail == node) list->tail = cursor->prev;
+   _ll_node_destroyer(list, node);
+   list->size--;
+   _ll_cursor_sync(cursor);
+}
+
+
+size_t ll_remove_if(linked_list* list, int (*predicate)(void*)) {
+   size_t removed = 0;
+   ll_cursor cursor = ll_cursor_begin(list);
+   while (!ll_cursor_is_end(&cursor)) {
+      if (predicate(cursor.node->data)) {
+         ll_cursor_erase(&cursor);
+         removed++;
+      } else
+         ll_cursor_next(&cursor);
+   }
+   return removed;
+}
+
+
+int _ll_same_storage(linked_list* list1, linked_list* list2) {
+   assert(list1 != list2 && "Lists must be different");
+   assert(list1->element_size == list2->element_size && "Lists have different element sizes");
+   return list1->pool ? list1->pool == list2->pool
+                      : list2->pool == NULL && list1->allocator.alloc == list2->allocator.alloc
+                        && list1->allocator.free == list2->allocator.free
+                        && list1->allocator.ctx == list2->allocator.ctx;
+}
+
+
+// Copies a chain of src into nodes of dest, the data moves so the destroyer is not called
+ll_node* _ll_adopt_chain(linked_list* dest, linked_list* src, ll_node* head, size_t count, ll_node** tail) {
+   ll_node* new_head = NULL, * new_tail = NULL;
+   for (ll_node* curr = head, * next; count--; curr = next) {
+      next = curr->next;
+      ll_node* node = ll_create_node(dest, curr->data);
+      if (new_tail) new_tail->next = node;
+      else new_head = node;
+      new_tail = node;
+      _ll_free_node(src, curr);
+   }
+   *tail = new_tail;
+   return new_head;
+}
+
+
+void ll_splice(linked_list* dest, ll_cursor* pos, linked_list* src, ll_cursor* first, ll_cursor* last) {
+   int same = _ll_same_storage(dest, src);
+   assert(first->index <= last->index && "Invalid Range");
+   size_t count = last->index - first->index;
+   if (count == 0) return;
+   ll_node* head = first->node, * tail = last->prev;
+   // Unlink [first, last) from the source
+   if (first->prev) first->prev->next = last->node;
+   else src->head = last->node;
+   if (last->node == NULL) src->tail = first->prev;
+   src->size -= count;
+   // Nodes of another storage cannot be relinked, they are copied into the storage of dest
+   if (!same) head = _ll_adopt_chain(dest, src, head, count, &tail);
+   // Link it before the position in the destination
+   tail->next = pos->node;
+   if (pos->prev) pos->prev->next = head;
+   else dest->head = head;
+   if (pos->node == NULL) dest->tail = tail;
+   dest->size += count;
+   pos->prev = tail;
+   pos->index += count;
+   _ll_forget_position(src);
+   _ll_cursor_sync(pos);
+}
+
+
+void ll_append_list(linked_list* dest, linked_list* src) {
+   int same = _ll_same_storage(dest, src);
+   if (src->head == NULL) return;
+   if (!same) src->head = _ll_adopt_chain(dest, src, src->head, src->size, &src->tail);
+   if (dest->tail) dest->tail->next = src->head;
+   else dest->head = src->head;
+   dest->tail = src->tail;
+   dest->size += src->size;
+   src->head = NULL;
+   src->tail = NULL;
+   src->size = 0;
+   _ll_forget_position(src);
+}
+
+
+void ll_merge(linked_list* dest, linked_list* src, int (*cmp)(void*, void*)) {
+   int same = _ll_same_storage(dest, src);
+   if (src->head == NULL) return;
+   if (!same) src->head = _ll_adopt_chain(dest, src, src->head, src->size, &src->tail);
+   ll_node* tail;
+   dest->head = _ll_merge_runs(dest->head, src->head, cmp, &tail);
+   dest->tail = tail;
+   dest->size += src->size;
+   src->head = NULL;
+   src->tail = NULL;
+   src->size = 0;
+   _ll_forget_position(dest);
+   _ll_forget_position(src);
+}
+
+
+size_t ll_partition(linked_list* list, int (*predicate)(void*)) {
+   ll_node* match_head = NULL, * match_tail = NULL;
+   ll_node* rest_head = NULL, * rest_tail = NULL;
+   size_t matches = 0;
+   for (ll_node* curr = list->head, * next; curr; curr = next) {
+      next = curr->next;
+      curr->next = NULL;
+      if (predicate(curr->data)) {
+         if (match_tail) match_tail->next = curr;
+         else match_head = curr;
+         match_tail = curr;
+         matches++;
+      } else {
+         if (rest_tail) rest_tail->next = curr;
+         else rest_head = curr;
+         rest_tail = curr;
+      }
+   }
+   if (match_tail) {
+      match_tail->next = rest_head;
+      list->head = match_head;
+      list->tail = rest_tail ? rest_tail : match_tail;
+   }
+   _ll_forget_position(list);
+   return matches;
+}
+
+
 
 // Remove all the elements from the list
 void ll_clear(linked_list* list) {
    ll_node* curr = list->head, * next = NULL;
+   // Nothing else holds nodes of an own pool, give them all back at once
+   if (list->owns_pool && list->destroyer == NULL) {
+      ll_pool_reset(list->pool);
+      curr = NULL;
+   }
    while (curr) {
       next = curr->next;
-      _ll_node_destroyer(list->destroyer, curr);
+      _ll_node_destroyer(list, curr);
       curr = next;
    }
    // Reset the list values
+   _ll_forget_position(list);
    list->head = NULL;
    list->tail = NULL;
    list->size = 0;
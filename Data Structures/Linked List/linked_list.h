@@ -9,19 +9,102 @@
 #define c_dsa_generic_singly_linked_list_h
 
 #include "stddef.h"
+#include "../../Memory/allocator.h"
 
 
 /**
  * @brief Node of a Singly Linked List
- * @var data: void pointer to the data
  * @var next: pointer to the next node
+ * @var data: the data, stored inline right after the next pointer
+ * @note A node and its data are one allocation of ll_node_bytes() bytes,
+ *       node->data decays to a pointer to the data, like ll_data()
 */
 typedef struct ll_node {
-   void* data;
    struct ll_node* next;
+   _Alignas(max_align_t) unsigned char data[];
 } ll_node;
 
 
+// Number of nodes in each slab of a pool created by ll_init_pooled().
+#ifndef LL_POOL_DEFAULT_SLAB_NODES
+#define LL_POOL_DEFAULT_SLAB_NODES 64
+#endif
+
+
+/**
+ * @brief A block of nodes allocated at once by a node pool
+ * @var next: pointer to the next slab
+ * @var nodes: storage of the nodes, `slab_nodes` slots of `node_size` bytes
+*/
+typedef struct ll_pool_slab {
+   struct ll_pool_slab* next;
+   max_align_t nodes[];
+} ll_pool_slab;
+
+
+/**
+ * @brief Pool of linked list nodes, allocated in slabs and recycled through a free list
+ * @var node_size: size of each node slot, the node and its data
+ * @var slab_nodes: number of nodes in each slab
+ * @var slab_count: number of slabs allocated
+ * @var live: number of nodes handed out and not yet released
+ * @var free_list: released nodes, chained through their next pointer
+ * @var slabs: pointer to the first slab
+ * @var current: slab the untouched nodes are taken from
+ * @var used: number of nodes taken from the current slab
+ * @var allocator: allocator used for the slabs
+ * @note A pool can be shared by several lists with the same element size, it is not thread safe
+*/
+typedef struct ll_pool {
+   size_t node_size;
+   size_t slab_nodes;
+   size_t slab_count;
+   size_t live;
+   ll_node* free_list;
+   ll_pool_slab* slabs;
+   ll_pool_slab* current;
+   size_t used;
+   dsa_allocator allocator;
+} ll_pool;
+
+
+/**
+ * @brief Occupancy of a node pool
+ * @var slabs: number of slabs allocated
+ * @var capacity: number of nodes the slabs can hold
+ * @var live: number of nodes in use
+ * @var free: number of nodes available without allocating
+ * @var bytes: number of bytes allocated for the slabs
+*/
+typedef struct ll_pool_stats {
+   size_t slabs;
+   size_t capacity;
+   size_t live;
+   size_t free;
+   size_t bytes;
+} ll_pool_stats;
+
+
+// A link counts as sequential when the next node starts after the current one and at most this
+// many bytes past its end, see ll_fragmentation().
+#ifndef LL_COMPACT_NEAR_BYTES
+#define LL_COMPACT_NEAR_BYTES 64
+#endif
+
+
+/**
+ * @brief Result of a compaction
+ * @var bytes_moved: number of bytes of data copied to the new nodes
+ * @var fragmentation_before: ll_fragmentation() of the list before the compaction
+ * @var fragmentation_after: ll_fragmentation() of the list after the compaction
+*/
+typedef struct ll_compact_stats {
+   size_t bytes_moved;
+   double fragmentation_before;
+   double fragmentation_after;
+} ll_compact_stats;
+
+
 /**
  * @brief Singly Linked List
  * @var length: length of the list
@@ -29,6 +112,15 @@ typedef struct ll_node {
  * @var tail: pointer to the tail node
  * @var element_size: size of each element in the list
  * @var destroyer: function pointer to the destroyer function
+ * @var allocator: allocator used for the nodes and their data
+ * @var pool: pool the nodes are taken from, NULL to use the allocator for each node
+ * @var owns_pool: 1 if the pool was created by the list and is freed with it
+ * @var cached_node: the node last reached by an indexed call, NULL if unknown
+ * @var cached_index: the index of cached_node
+ * @var compact_threshold: fragmentation above which indexed changes compact the list, 0 to never
+ * @var compact_countdown: number of indexed changes left before the fragmentation is checked again
+ * @note Indexed calls (ll_node_at(), ll_data_at(), ll_insert_at(), ...) resume from cached_node
+ *       when the index is not before it, so looping over increasing indices is O(n) overall
 */
 typedef struct linked_list {
    size_t size;
@@ -36,8 +128,32 @@ typedef struct linked_list {
    ll_node* tail;
    size_t element_size;
    void (*destroyer)(ll_node*);
+   dsa_allocator allocator;
+   ll_pool* pool;
+   int owns_pool;
+   ll_node* cached_node;
+   size_t cached_index;
+   double compact_threshold;
+   size_t compact_countdown;
 } linked_list;
 
+
+/**
+ * @brief Position in a Singly Linked List
+ * @var list: pointer to the list
+ * @var prev: pointer to the node before the position, NULL at the beginning
+ * @var node: pointer to the node at the position, NULL at the end
+ * @var index: index of the position
+ * @note Keeping the previous node makes insertion and removal at the cursor O(1)
+ * @warning A cursor is invalidated by any change of the list not made through it
+*/
+typedef struct ll_cursor {
+   linked_list* list;
+   ll_node* prev;
+   ll_node* node;
+   size_t index;
+} ll_cursor;
+
 /**
  * @brief Factory function to create a new Singly Linked List with a destroyer function
  * @param element_size: size of each element in the list
@@ -49,12 +165,172 @@ typedef struct linked_list {
  *    The parameter is the pointer to the node that is to be destroyed
  *    The function should free the memory of the pointer(s) that is(are) stored in the data field
  *    Or it may cause memory leak
- * @note Use ll_node_free() to free the memory of a node
+ * @note Use ll_node_free() inside the destroyer to free the memory of a node,
+ *       and ll_release_node() for a node created with ll_create_node() that was never linked
  * Time Complexity: O(1)
 */
 linked_list ll_init_with_destroyer(size_t element_size, void (*destroyer)(ll_node*));
 
 
+/**
+ * @brief Factory function to create a new Singly Linked List with a custom allocator
+ * @param element_size: size of each element in the list
+ * @param destroyer: function pointer to the destroyer function, may be NULL
+ * @param allocator: allocator used for the nodes and their data, NULL for malloc
+ * @return LinkedList: a new Singly Linked List wrapped in a struct
+ * @note A custom destroyer can still release the node with ll_node_free(),
+ *       it is given back to the allocator of the list
+ * Time Complexity: O(1)
+*/
+linked_list ll_init_with_allocator(size_t element_size, void (*destroyer)(ll_node*), dsa_allocator* allocator);
+
+
+/**
+ * @brief Factory function to create a new Singly Linked List taking its nodes from its own pool
+ * @param element_size: size of each element in the list
+ * @param slab_nodes: number of nodes allocated at once, 0 for LL_POOL_DEFAULT_SLAB_NODES
+ * @return LinkedList: a new Singly Linked List wrapped in a struct
+ * @note Removed nodes are recycled instead of freed, ll_clear() is O(1)
+ *       and the slabs are released by ll_free()
+ * Time Complexity: O(1)
+*/
+linked_list ll_init_pooled(size_t element_size, size_t slab_nodes);
+
+
+/**
+ * @brief Factory function to create a new Singly Linked List taking its nodes from a shared pool
+ * @param element_size: size of each element in the list
+ * @param destroyer: function pointer to the destroyer function, may be NULL
+ * @param pool: pointer to the pool, created by ll_pool_init() for at least element_size bytes
+ * @return LinkedList: a new Singly Linked List wrapped in a struct
+ * @warning The pool must outlive the list, it is not freed by ll_free()
+ * Time Complexity: O(1)
+*/
+linked_list ll_init_with_pool(size_t element_size, void (*destroyer)(ll_node*), ll_pool* pool);
+
+
+/**
+ * @brief Factory function to create a new node pool
+ * @param element_size: size of the data of each node
+ * @param slab_nodes: number of nodes allocated at once, 0 for LL_POOL_DEFAULT_SLAB_NODES
+ * @param allocator: allocator used for the slabs, NULL for malloc
+ * @return ll_pool: an empty pool, no slab is allocated until the first node is needed
+ * Time Complexity: O(1)
+*/
+ll_pool ll_pool_init(size_t element_size, size_t slab_nodes, dsa_allocator* allocator);
+
+
+/**
+ * @brief Returns the number of bytes of each slab of the pool
+ * @param pool: pointer to the pool
+ * @note This function is used internally by the library
+ * Time Complexity: O(1)
+*/
+size_t __ll_pool_slab_bytes(ll_pool* pool);
+
+
+/**
+ * @brief Takes a node from the pool
+ * @param pool: pointer to the pool
+ * @return ll_node: pointer to an uninitialized node
+ * @note Recycled nodes are used first, then untouched nodes of the slabs,
+ *       a new slab is allocated only when both run out
+ * Time Complexity: O(1)
+*/
+ll_node* ll_pool_acquire(ll_pool* pool);
+
+
+/**
+ * @brief Gives a node back to the pool
+ * @param pool: pointer to the pool
+ * @param node: pointer to the node, taken from the same pool
+ * Time Complexity: O(1)
+*/
+void ll_pool_release(ll_pool* pool, ll_node* node);
+
+
+/**
+ * @brief Gives every node back to the pool at once, the slabs are kept for reuse
+ * @param pool: pointer to the pool
+ * @warning Every node of the pool becomes invalid, do not use it while a list still holds nodes
+ * Time Complexity: O(1)
+*/
+void ll_pool_reset(ll_pool* pool);
+
+
+/**
+ * @brief Returns the occupancy of the pool
+ * @param pool: pointer to the pool
+ * Time Complexity: O(1)
+*/
+ll_pool_stats ll_pool_get_stats(ll_pool* pool);
+
+
+/**
+ * @brief Releases every slab of the pool
+ * @param pool: pointer to the pool
+ * @warning Every node of the pool becomes invalid
+ * Time Complexity: O(number of slabs)
+*/
+void ll_pool_free(ll_pool* pool);
+
+
+/**
+ * @brief Returns the occupancy of the pool of the list
+ * @param list: pointer to the list
+ * @note Returns all zeros if the list does not use a pool
+ * Time Complexity: O(1)
+*/
+ll_pool_stats ll_get_pool_stats(linked_list* list);
+
+
+/**
+ * @brief Measures how scattered the nodes of the list are in memory
+ * @param list: pointer to the list
+ * @return double: fraction of the links, from 0 to 1, that do not lead to a node lying just after
+ *         the current one, 0 if the list has less than two nodes
+ * Time Complexity: O(n)
+*/
+double ll_fragmentation(linked_list* list);
+
+
+/**
+ * @brief Moves the nodes into contiguous memory in list order, so that traversals are sequential
+ * @param list: pointer to the list
+ * @return ll_compact_stats: the bytes moved and the fragmentation before and after
+ * @note The nodes are moved into one slab of a new pool owned by the list, a list that did not
+ *       use a pool keeps it afterwards, as if it had been created by ll_init_pooled()
+ * @note The list then no longer shares its node storage with the lists it shared an allocator
+ *       with, ll_splice(), ll_append_list() and ll_merge() copy the nodes between them
+ * @note A list using a pool it does not own is left unchanged, its nodes cannot leave the pool
+ * @warning Every node pointer and cursor of the list becomes invalid, the data is not destroyed
+ * Time Complexity: O(n)
+*/
+ll_compact_stats ll_compact(linked_list* list);
+
+
+/**
+ * @brief Makes ll_insert_at() and ll_delete_at() compact the list when it gets too fragmented
+ * @param list: pointer to the list
+ * @param threshold: fragmentation, from 0 to 1, above which the list is compacted, 0 to disable
+ * @note The fragmentation is checked once every size changes, which keeps the check O(1) amortized
+ * @warning Node pointers then do not survive ll_insert_at() and ll_delete_at()
+ * @warning A compaction moves the nodes to a pool of the list, see ll_compact(), so relinking
+ *       with lists sharing its allocator copies the nodes instead
+ * Time Complexity: O(1)
+*/
+void ll_set_auto_compact(linked_list* list, double threshold);
+
+
+/**
+ * @brief Counts an indexed change and compacts the list if it is due and too fragmented
+ * @param list: pointer to the list
+ * @note This function is used internally by the library
+ * Time Complexity: O(1) amortized
+*/
+void _ll_maybe_compact(linked_list* list);
+
+
 /**
  * @brief Factory function to create a new Singly Linked List with default destroyer function
  * @param element_size: size of each element in the list
@@ -73,11 +349,21 @@ linked_list ll_init(size_t element_size);
  * @param data: pointer to the data
  * @return ll_node: pointer to the new node
  * @note The data will be shallow copied
+ * @note Release an unlinked node with ll_release_node(), it may come from the pool or allocator of the list
  * Time Complexity: O(1)
 */
 ll_node* ll_create_node(linked_list* list, void* data);
 
 
+/**
+ * @brief Returns the number of bytes allocated for a node of the list
+ * @param list: pointer to the list
+ * @return size_t: sizeof(ll_node) plus the element size
+ * Time Complexity: O(1)
+*/
+size_t ll_node_bytes(linked_list* list);
+
+
 /**
  * @brief Function to get the length of the list
  * @param list: pointer to the list
@@ -93,25 +379,50 @@ size_t ll_size(linked_list* list);
  * @param node: pointer to the node
  * @warning This function will not free the the pointer(s) that is(are) stored in the data field
  * @note Use a custom destroyer function to free the pointers
+ * @note Inside a custom destroyer the node goes back to the pool or allocator of the list being modified,
+ *       anywhere else it is released with free()
+ * @warning Outside a custom destroyer this only works for lists created without a pool or allocator,
+ *          use ll_release_node() otherwise
  * Time Complexity: O(1)
 */
 void ll_node_destroyer(ll_node* node);
 
 
+/**
+ * @brief Function to free the memory of a node created by the given list
+ * @param list: pointer to the list that created the node
+ * @param node: pointer to the node, it must not be linked in the list
+ * @warning This function will not free the the pointer(s) that is(are) stored in the data field
+ * @note The node goes back to the pool or allocator of the list, works for every list
+ * Time Complexity: O(1)
+*/
+void ll_release_node(linked_list* list, ll_node* node);
+
+
+/**
+ * @brief Function to free the memory of a node allocated by the given list
+ * @param list: pointer to the list that created the node
+ * @param node: pointer to the node
+ * Time Complexity: O(1)
+*/
+void _ll_free_node(linked_list* list, ll_node* node);
+
+
 /**
  * @brief Same as ll_node_destroyer()
  * @note Calls ll_node_destroyer() internally
+ * @warning Outside a custom destroyer use ll_release_node() for pooled lists or lists with an allocator
  * Time Complexity: O(1)
 */
 void ll_node_free(ll_node* node);
 
 /**
- * If the destroyer function is defined, it will be called
- * Otherwise, it will call ll_node_destroyer()
- * @param destroyer: function pointer to the destroyer function
+ * If the destroyer function of the list is defined, it will be called
+ * Otherwise, the node is given back to the allocator of the list
+ * @param list: pointer to the list owning the node
  * @param node: pointer to the node
 */
-void _ll_node_destroyer(void (*destroyer)(ll_node*), ll_node* node);
+void _ll_node_destroyer(linked_list* list, ll_node* node);
 
 
 /**
@@ -228,7 +539,7 @@ int ll_node_cmp(ll_node* node1, ll_node* node2, size_t size);
 
 
 /**
- * @brief Removes the first node that matches the given data
+ * @brief Removes all the nodes that match the given data
  * @param list: pointer to the list
  * @param data: pointer to the data
  * @param cmp: function pointer to the comparator function
@@ -236,14 +547,15 @@ int ll_node_cmp(ll_node* node1, ll_node* node2, size_t size);
  *     int cmp(const void*, const void*, size_t)
  *         The first two parameters are the pointers to the data
  *         The third parameter is the size of each element in the list
- * @node Internally calls ll_node_destroyer() or the custom destroyer function
+ * @note Internally calls ll_node_destroyer() or the custom destroyer function
+ * @note Single pass, the nodes are unlinked as they are found
  * Time Complexity: O(n)
 */
 void ll_remove_cmp(linked_list* list, void* data, int (*cmp)(const void*, const void*, size_t));
 
 
 /**
- * @brief Removes the first node that matches the given data
+ * @brief Removes all the nodes that match the given data
  * @param list: pointer to the list
  * @param data: pointer to the data
  * @note Internally calls ll_remove_cmp()
@@ -300,6 +612,7 @@ void ll_erase_after_index(linked_list* list, size_t index);
  * @param index: index of the node
  * Time Complexity: O(n)
  * @note Returns NULL if the index is out of range or the list is empty
+ * @note Starts from the cached position when the index is not before it, the tail is O(1)
  * Time Complexity: O(n)
 */
 ll_node* ll_node_at(linked_list* list, size_t index);
@@ -450,6 +763,251 @@ int ll_contains_node(linked_list* list, ll_node* node);
 void ll_reverse(linked_list* list);
 
 
+/**
+ * @brief Cuts the chain of nodes after its n-th node
+ * @param node: pointer to the first node of the chain, may be NULL
+ * @param n: number of nodes to keep, at least 1
+ * @return ll_node: pointer to the first node cut off, NULL if the chain was not longer than n
+ * @note This function is used internally by the library
+ * Time Complexity: O(n)
+*/
+ll_node* _ll_split(ll_node* node, size_t n);
+
+
+/**
+ * @brief Merges two sorted chains of nodes by relinking them
+ * @param left: pointer to the first node of the first chain, may be NULL
+ * @param right: pointer to the first node of the second chain, may be NULL
+ * @param cmp: function pointer to the comparator function
+ * @param tail: set to the last node of the merged chain
+ * @return ll_node: pointer to the first node of the merged chain
+ * @note Equal elements keep the order of left before right
+ * @note This function is used internally by the library
+ * Time Complexity: O(n)
+*/
+ll_node* _ll_merge_runs(ll_node* left, ll_node* right, int (*cmp)(void*, void*), ll_node** tail);
+
+
+/**
+ * @brief Sorts the list with the given comparator
+ * @param list: pointer to the list
+ * @param cmp: function pointer to the comparator function
+ * @note The comparator function should have the following signature:
+ *    int cmp(void*, void*)
+ *    The parameters are the pointers to the data, like the comparators of sort()
+ * @note Bottom up merge sort, stable, only the next pointers are relinked and nothing is allocated
+ * Time Complexity: O(n log n)
+*/
+void ll_sort_cmp(linked_list* list, int (*cmp)(void*, void*));
+
+
+/**
+ * @brief Sorts the list of int
+ * @param list: pointer to the list
+ * @note Internally calls ll_sort_cmp() with int_cmp as the comparator function
+ * Time Complexity: O(n log n)
+*/
+void ll_sort(linked_list* list);
+
+
+/**
+ * @brief Drops the cached position of the list
+ * @param list: pointer to the list
+ * @note This function is used internally by the library
+ * Time Complexity: O(1)
+*/
+void _ll_forget_position(linked_list* list);
+
+
+/**
+ * @brief Caches the position of a node for the next indexed call
+ * @param list: pointer to the list
+ * @param node: pointer to the node
+ * @param index: index of the node
+ * @note This function is used internally by the library
+ * Time Complexity: O(1)
+*/
+void _ll_remember_position(linked_list* list, ll_node* node, size_t index);
+
+
+/**
+ * @brief Returns a cursor at the beginning of the list
+ * @param list: pointer to the list
+ * Time Complexity: O(1)
+*/
+ll_cursor ll_cursor_begin(linked_list* list);
+
+
+/**
+ * @brief Returns a cursor at the given index
+ * @param list: pointer to the list
+ * @param index: index of the position, the size of the list for the end
+ * @note Resumes from the cached position of the list like ll_node_at()
+ * Time Complexity: O(n)
+*/
+ll_cursor ll_cursor_at(linked_list* list, size_t index);
+
+
+/**
+ * @brief Returns 1 if the cursor is past the last node, 0 otherwise
+ * @param cursor: pointer to the cursor
+ * Time Complexity: O(1)
+*/
+int ll_cursor_is_end(ll_cursor* cursor);
+
+
+/**
+ * @brief Moves the cursor to the next node
+ * @param cursor: pointer to the cursor, not at the end
+ * Time Complexity: O(1)
+*/
+void ll_cursor_next(ll_cursor* cursor);
+
+
+/**
+ * @brief Returns the data of the node at the cursor
+ * @param cursor: pointer to the cursor, not at the end
+ * Time Complexity: O(1)
+*/
+void* ll_cursor_data(ll_cursor* cursor);
+
+
+/**
+ * @brief Sets the data of the node at the cursor
+ * @param cursor: pointer to the cursor, not at the end
+ * @param data: pointer to the data
+ * @note The data will be shallow copied
+ * Time Complexity: O(1)
+*/
+void ll_cursor_set(ll_cursor* cursor, void* data);
+
+
+/**
+ * @brief Keeps the cached position of the list in sync after an edit through the cursor
+ * @param cursor: pointer to the cursor
+ * @note This function is used internally by the library
+ * Time Complexity: O(1)
+*/
+void _ll_cursor_sync(ll_cursor* cursor);
+
+
+/**
+ * @brief Inserts a new node at the position of the cursor
+ * @param cursor: pointer to the cursor, may be at the end
+ * @param data: pointer to the data
+ * @note The cursor stays on the same node, whose index grows by one
+ * Time Complexity: O(1)
+*/
+void ll_cursor_insert_before(ll_cursor* cursor, void* data);
+
+
+/**
+ * @brief Inserts a new node after the node at the cursor
+ * @param cursor: pointer to the cursor, not at the end
+ * @param data: pointer to the data
+ * @note The cursor does not move, ll_cursor_next() reaches the new node
+ * Time Complexity: O(1)
+*/
+void ll_cursor_insert_after(ll_cursor* cursor, void* data);
+
+
+/**
+ * @brief Removes the node at the cursor, the cursor moves to the next node
+ * @param cursor: pointer to the cursor, not at the end
+ * @note internally calls ll_node_destroyer() or the custom destroyer function
+ * Time Complexity: O(1)
+*/
+void ll_cursor_erase(ll_cursor* cursor);
+
+
+/**
+ * @brief Removes all the nodes whose data matches the predicate
+ * @param list: pointer to the list
+ * @param predicate: function pointer returning non zero for the data to remove
+ * @return size_t: number of nodes removed
+ * @note Single pass, internally calls ll_node_destroyer() or the custom destroyer function
+ * Time Complexity: O(n)
+*/
+size_t ll_remove_if(linked_list* list, int (*predicate)(void*));
+
+
+/**
+ * @brief Returns 1 if nodes can be relinked between two lists, 0 if they have to be copied
+ * @param list1: pointer to the first list
+ * @param list2: pointer to the second list
+ * @note The lists must be different and have the same element size, they share their storage
+ *       when they allocate their nodes from the same pool or allocator
+ * @note This function is used internally by the library
+ * Time Complexity: O(1)
+*/
+int _ll_same_storage(linked_list* list1, linked_list* list2);
+
+
+/**
+ * @brief Copies a chain of nodes of src into new nodes of dest and frees the old ones
+ * @param dest: pointer to the list the new nodes are allocated for
+ * @param src: pointer to the list the chain was allocated for, already unlinked from it
+ * @param head: pointer to the first node of the chain
+ * @param count: number of nodes of the chain
+ * @param tail: set to the last new node
+ * @return ll_node: pointer to the first new node
+ * @note The data is moved, the destroyer is not called
+ * @note This function is used internally by the library
+ * Time Complexity: O(count)
+*/
+ll_node* _ll_adopt_chain(linked_list* dest, linked_list* src, ll_node* head, size_t count, ll_node** tail);
+
+
+/**
+ * @brief Moves the nodes of [first, last) from src to dest, before pos
+ * @param dest: pointer to the destination list
+ * @param pos: pointer to a cursor of dest, it stays on the same node
+ * @param src: pointer to the source list
+ * @param first: pointer to a cursor of src at the first node to move
+ * @param last: pointer to a cursor of src after the last node to move, not before first
+ * @note The nodes are relinked, nothing is copied or allocated, if the lists share their storage.
+ *       Otherwise, e.g. when only one of them was compacted by ll_compact(), each node is copied
+ *       into the storage of dest, O(last - first)
+ * @warning Other cursors of src are invalidated
+ * Time Complexity: O(1)
+*/
+void ll_splice(linked_list* dest, ll_cursor* pos, linked_list* src, ll_cursor* first, ll_cursor* last);
+
+
+/**
+ * @brief Moves all the nodes of src to the end of dest, src becomes empty
+ * @param dest: pointer to the destination list
+ * @param src: pointer to the source list
+ * @note The nodes are relinked, nothing is copied or allocated, if the lists share their storage.
+ *       Otherwise each node is copied into the storage of dest, O(m)
+ * Time Complexity: O(1)
+*/
+void ll_append_list(linked_list* dest, linked_list* src);
+
+
+/**
+ * @brief Merges the sorted list src into the sorted list dest, src becomes empty
+ * @param dest: pointer to the destination list
+ * @param src: pointer to the source list
+ * @param cmp: function pointer to the comparator function, like the one of ll_sort_cmp()
+ * @note Stable, equal elements of dest come first. The nodes are relinked, nothing is copied,
+ *       if the lists share their storage. Otherwise the nodes of src are copied first, O(m)
+ * Time Complexity: O(n + m)
+*/
+void ll_merge(linked_list* dest, linked_list* src, int (*cmp)(void*, void*));
+
+
+/**
+ * @brief Moves the nodes whose data matches the predicate before the others, keeping their order
+ * @param list: pointer to the list
+ * @param predicate: function pointer returning non zero for the data to move first
+ * @return size_t: number of matching nodes, the index of the first other node
+ * @note The nodes are relinked, nothing is copied
+ * Time Complexity: O(n)
+*/
+size_t ll_partition(linked_list* list, int (*predicate)(void*));
+
+
 /**
  * @brief Returns 1 if the list is empty, 0 otherwise
  * @param list: pointer to the list
@@ -498,6 +1056,7 @@ void* ll_back(linked_list* list);
  * @brief Clears the list
  * @param list: pointer to the list
  * @note Internally calls ll_node_destroyer() or the custom destroyer function
+ * @note O(1) for a list created by ll_init_pooled() without a destroyer, its pool is reset
  * Time Complexity: O(n)
 */
 void ll_clear(linked_list* list);
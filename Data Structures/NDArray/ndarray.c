@@ -0,0 +1,514 @@
+/**
+ * Library for n-dimensional strided arrays.
+ * Author : Abinash Karmakar
+ * 2023-09-01 MIT License Version: 1.0
+ */
+
+#ifndef c_dsa_generic_ndarray_c
+#define c_dsa_generic_ndarray_c
+
+#include "ndarray.h"
+
+#include "../../Memory/allocator.c"  // TODO: Remove this
+#include "assert.h"
+#include "string.h"
+
+/**
+ * @brief Factory function for creating an n-dimensional array with a custom allocator.
+ * @param ndim The number of dimensions, at most ND_MAX_DIMS.
+ * @param shape The number of elements along each axis.
+ * @param element_size The size of each element.
+ * @param allocator The allocator used for the elements, NULL for malloc.
+ * @return The array, in row-major order with every element set to 0.
+ * Time complexity: O(n)
+ */
+ndarray nd_init_with_allocator(size_t ndim, size_t* shape, size_t element_size, dsa_allocator* allocator) {
+   assert(ndim <= ND_MAX_DIMS && "Too many dimensions");
+   ndarray nd;
+   nd.ndim = ndim;
+   nd.element_size = element_size;
+   // Row-major strides, the last axis is contiguous.
+   size_t stride = element_size;
+   for (size_t d = ndim; d-- > 0;) {
+      nd.shape[d] = shape[d];
+      nd.strides[d] = stride;
+      stride *= shape[d];
+   }
+   nd.allocator = allocator ? *allocator : dsa_default_allocator();
+   nd.base_size = stride;
+   nd.base = stride ? dsa_alloc(&nd.allocator, stride) : NULL;
+   assert((nd.base || stride == 0) && "Not Enough Memory!");
+   if (nd.base) memset(nd.base, 0, stride);
+   nd.data = nd.base;
+   return nd;
+}
+
+/**
+ * @brief Factory function for creating an n-dimensional array.
+ * @param ndim The number of dimensions, at most ND_MAX_DIMS.
+ * @param shape The number of elements along each axis.
+ * @param element_size The size of each element.
+ * @return The array, in row-major order with every element set to 0.
+ * Time complexity: O(n)
+ */
+ndarray nd_init(size_t ndim, size_t* shape, size_t element_size) {
+   return nd_init_with_allocator(ndim, shape, element_size, NULL);
+}
+
+/**
+ * @brief Function to view a row-major buffer as an n-dimensional array.
+ * @param data Pointer to the first element.
+ * @param ndim The number of dimensions, at most ND_MAX_DIMS.
+ * @param shape The number of elements along each axis.
+ * @param element_size The size of each element.
+ * @return The view, the buffer is not copied nor freed.
+ * Time complexity: O(ndim)
+ */
+ndarray nd_from_buffer(void* data, size_t ndim, size_t* shape, size_t element_size) {
+   assert(ndim <= ND_MAX_DIMS && "Too many dimensions");
+   ndarray nd;
+   nd.ndim = ndim;
+   nd.element_size = element_size;
+   size_t stride = element_size;
+   for (size_t d = ndim; d-- > 0;) {
+      nd.shape[d] = shape[d];
+      nd.strides[d] = stride;
+      stride *= shape[d];
+   }
+   nd.data = data;
+   nd.base = NULL;
+   nd.base_size = 0;
+   nd.allocator = dsa_default_allocator();
+   return nd;
+}
+
+/**
+ * @brief Function to view the elements of an array as an n-dimensional array.
+ * @param arr The array.
+ * @param ndim The number of dimensions, at most ND_MAX_DIMS.
+ * @param shape The number of elements along each axis, their product must be the size of the array.
+ * @return The view.
+ * Time complexity: O(ndim)
+ */
+ndarray nd_from_array(array* arr, size_t ndim, size_t* shape) {
+   ndarray nd = nd_from_buffer(arr->data, ndim, shape, arr->element_size);
+   assert(nd_size(&nd) == arr->size && "Shape does not match the size of the array");
+   return nd;
+}
+
+/**
+ * @brief Function to get the number of dimensions.
+ * @param nd The n-dimensional array.
+ * @return The number of dimensions.
+ * Time complexity: O(1)
+ */
+size_t nd_ndim(ndarray* nd) {
+   return nd->ndim;
+}
+
+/**
+ * @brief Function to get the number of elements along an axis.
+ * @param nd The n-dimensional array.
+ * @param axis The axis.
+ * @return The number of elements.
+ * Time complexity: O(1)
+ */
+size_t nd_shape(ndarray* nd, size_t axis) {
+   assert(axis < nd->ndim && "Axis out of bounds");
+   return nd->shape[axis];
+}
+
+/**
+ * @brief Function to get the total number of elements.
+ * @param nd The n-dimensional array.
+ * @return The product of the shape.
+ * Time complexity: O(ndim)
+ */
+size_t nd_size(ndarray* nd) {
+   size_t size = 1;
+   for (size_t d = 0; d < nd->ndim; d++)
+      size *= nd->shape[d];
+   return size;
+}
+
+/**
+ * @brief Function to check if the elements are contiguous in row-major order.
+ * @param nd The n-dimensional array.
+ * @return 1 if contiguous, 0 otherwise.
+ * Time complexity: O(ndim)
+ */
+int nd_is_contiguous(ndarray* nd) {
+   size_t expected = nd->element_size;
+   for (size_t d = nd->ndim; d-- > 0;) {
+      if (nd->shape[d] != 1 && nd->strides[d] != expected) return 0;
+      expected *= nd->shape[d];
+   }
+   return 1;
+}
+
+/**
+ * @brief Function to get void pointer to an element.
+ * @param nd The n-dimensional array.
+ * @param index The index along each axis.
+ * @return A void pointer to the element.
+ * Time complexity: O(ndim)
+ */
+void* nd_at(ndarray* nd, size_t* index) {
+   void* ptr = nd->data;
+   for (size_t d = 0; d < nd->ndim; d++) {
+      assert(index[d] < nd->shape[d] && "Index out of bounds");
+      ptr += index[d] * nd->strides[d];
+   }
+   return ptr;
+}
+
+/**
+ * @brief Function to get void pointer to an element of a 2 dimensional array.
+ * @param nd The n-dimensional array.
+ * @param i The row.
+ * @param j The column.
+ * @return A void pointer to the element.
+ * Time complexity: O(1)
+ */
+void* nd_at2(ndarray* nd, size_t i, size_t j) {
+   assert(nd->ndim == 2 && "Array is not 2 dimensional");
+   size_t index[] = { i, j };
+   return nd_at(nd, index);
+}
+
+/**
+ * @brief Function to get void pointer to an element of a 3 dimensional array.
+ * @param nd The n-dimensional array.
+ * @param i The index along the first axis.
+ * @param j The index along the second axis.
+ * @param k The index along the third axis.
+ * @return A void pointer to the element.
+ * Time complexity: O(1)
+ */
+void* nd_at3(ndarray* nd, size_t i, size_t j, size_t k) {
+   assert(nd->ndim == 3 && "Array is not 3 dimensional");
+   size_t index[] = { i, j, k };
+   return nd_at(nd, index);
+}
+
+/**
+ * @brief Function to view a range of an axis.
+ * @param nd The n-dimensional array.
+ * @param axis The axis.
+ * @param start The first index kept.
+ * @param end The index past the last one kept.
+ * @param step The step between kept indexes, 1 keeps every index.
+ * @return The view.
+ * Time complexity: O(1)
+ */
+ndarray nd_slice(ndarray* nd, size_t axis, size_t start, size_t end, size_t step) {
+   assert(axis < nd->ndim && "Axis out of bounds");
+   assert(start <= end && end <= nd->shape[axis] && "Range out of bounds");
+   assert(step > 0 && "Step must be positive");
+   ndarray view = *nd;
+   view.base = NULL;
+   view.data += start * nd->strides[axis];
+   view.shape[axis] = (end - start + step - 1) / step;
+   view.strides[axis] *= step;
+   return view;
+}
+
+/**
+ * @brief Function to view the elements at one index of an axis, e.g. a row of a matrix.
+ * @param nd The n-dimensional array.
+ * @param axis The axis removed from the view.
+ * @param index The index along the axis.
+ * @return The view, with one dimension less.
+ * Time complexity: O(ndim)
+ */
+ndarray nd_index(ndarray* nd, size_t axis, size_t index) {
+   assert(axis < nd->ndim && "Axis out of bounds");
+   assert(index < nd->shape[axis] && "Index out of bounds");
+   ndarray view = *nd;
+   view.base = NULL;
+   view.data += index * nd->strides[axis];
+   for (size_t d = axis; d + 1 < nd->ndim; d++) {
+      view.shape[d] = nd->shape[d + 1];
+      view.strides[d] = nd->strides[d + 1];
+   }
+   view.ndim--;
+   return view;
+}
+
+/**
+ * @brief Function to view the array with two axes swapped.
+ * @param nd The n-dimensional array.
+ * @param axis_a The first axis.
+ * @param axis_b The second axis.
+ * @return The view, e.g. the transposed matrix for axes 0 and 1.
+ * Time complexity: O(1)
+ */
+ndarray nd_transpose(ndarray* nd, size_t axis_a, size_t axis_b) {
+   assert(axis_a < nd->ndim && axis_b < nd->ndim && "Axis out of bounds");
+   ndarray view = *nd;
+   view.base = NULL;
+   view.shape[axis_a] = nd->shape[axis_b];
+   view.strides[axis_a] = nd->strides[axis_b];
+   view.shape[axis_b] = nd->shape[axis_a];
+   view.strides[axis_b] = nd->strides[axis_a];
+   return view;
+}
+
+/**
+ * @brief Function to view the array with its axes reordered.
+ * @param nd The n-dimensional array.
+ * @param axes Axis d of the view is axis axes[d] of the array.
+ * @return The view.
+ * Time complexity: O(ndim)
+ */
+ndarray nd_permute(ndarray* nd, size_t* axes) {
+   ndarray view = *nd;
+   view.base = NULL;
+   int seen[ND_MAX_DIMS] = { 0 };
+   for (size_t d = 0; d < nd->ndim; d++) {
+      assert(axes[d] < nd->ndim && !seen[axes[d]] && "Axes must be a permutation");
+      seen[axes[d]] = 1;
+      view.shape[d] = nd->shape[axes[d]];
+      view.strides[d] = nd->strides[axes[d]];
+   }
+   return view;
+}
+
+/**
+ * @brief Function to check that two arrays have the same shape.
+ * @param a The first array.
+ * @param b The second array.
+ * Time complexity: O(ndim)
+ * @note This function is used internally by the library.
+ */
+void __nd_check_same_shape(ndarray* a, ndarray* b) {
+   assert(a->ndim == b->ndim && "Arrays must have the same shape");
+   for (size_t d = 0; d < a->ndim; d++)
+      assert(a->shape[d] == b->shape[d] && "Arrays must have the same shape");
+}
+
+/**
+ * @brief Function to visit every element of one array, or the matching elements of two arrays.
+ * @param a The array.
+ * @param b The second array with the same shape, or NULL.
+ * @param tile 0 to visit in row-major order, otherwise the edge of the square tiles
+ * the last two axes are visited by.
+ * @param visit Called with the element of `a`, the element of `b` (or NULL) and the context.
+ * @param context Passed to `visit`.
+ * Time complexity: O(n)
+ * @note This function is used internally by the library.
+ */
+void __nd_walk(ndarray* a, ndarray* b, size_t tile, void (*visit)(void*, void*, void*), void* context) {
+   if (b) __nd_check_same_shape(a, b);
+   if (nd_size(a) == 0) return;
+   // The last axis, or the last two when tiling, are walked by the inner loops,
+   // the outer axes by an odometer over `index`.
+   size_t inner = tile && a->ndim >= 2 ? 2 : a->ndim ? 1 : 0;
+   size_t outer = a->ndim - inner;
+   size_t index[ND_MAX_DIMS] = { 0 };
+   for (;;) {
+      void* pa = a->data;
+      void* pb = b ? b->data : NULL;
+      for (size_t d = 0; d < outer; d++) {
+         pa += index[d] * a->strides[d];
+         if (b) pb += index[d] * b->strides[d];
+      }
+      if (inner == 0) {
+         visit(pa, pb, context);
+      } else if (inner == 1) {
+         size_t c = a->ndim - 1;
+         for (size_t j = 0; j < a->shape[c]; j++)
+            visit(pa + j * a->strides[c], b ? pb + j * b->strides[c] : NULL, context);
+      } else {
+         size_t r = a->ndim - 2, c = a->ndim - 1;
+         for (size_t ti = 0; ti < a->shape[r]; ti += tile) {
+            size_t ri = ti + tile < a->shape[r] ? ti + tile : a->shape[r];
+            for (size_t tj = 0; tj < a->shape[c]; tj += tile) {
+               size_t rj = tj + tile < a->shape[c] ? tj + tile : a->shape[c];
+               for (size_t i = ti; i < ri; i++)
+                  for (size_t j = tj; j < rj; j++)
+                     visit(pa + i * a->strides[r] + j * a->strides[c],
+                           b ? pb + i * b->strides[r] + j * b->strides[c] : NULL, context);
+            }
+         }
+      }
+      size_t d = outer;
+      for (;;) {
+         if (d == 0) return;
+         d--;
+         if (++index[d] < a->shape[d]) break;
+         index[d] = 0;
+      }
+   }
+}
+
+/**
+ * @brief Visitor of __nd_walk() calling a callback with each element.
+ * @param element The element.
+ * @param unused The element of the second array, there is none.
+ * @param context Pointer to the callback.
+ * Time complexity: O(1)
+ * @note This function is used internally by the library.
+ */
+void __nd_visit_each(void* element, void* unused, void* context) {
+   (void)unused;
+   (*(void (**)(void*))context)(element);
+}
+
+/**
+ * @brief Function to call a callback on every element, in row-major order.
+ * @param nd The n-dimensional array.
+ * @param callback The callback.
+ * Time complexity: O(n)
+ */
+void nd_for_each(ndarray* nd, void (*callback)(void*)) {
+   __nd_walk(nd, NULL, 0, __nd_visit_each, &callback);
+}
+
+/**
+ * @brief Function to call a callback on every element, tile by tile over the last two axes.
+ * @param nd The n-dimensional array.
+ * @param callback The callback.
+ * Time complexity: O(n)
+ * @note Each ND_TILE x ND_TILE tile stays in cache while it is visited, whatever the strides.
+ */
+void nd_for_each_tiled(ndarray* nd, void (*callback)(void*)) {
+   __nd_walk(nd, NULL, ND_TILE, __nd_visit_each, &callback);
+}
+
+/**
+ * @brief Visitor of __nd_walk() copying an element of the second array into the first one.
+ * @param dest The element of the destination.
+ * @param src The element of the source.
+ * @param context Pointer to the element size.
+ * Time complexity: O(1)
+ * @note This function is used internally by the library.
+ */
+void __nd_visit_copy(void* dest, void* src, void* context) {
+   memcpy(dest, src, *(size_t*)context);
+}
+
+/**
+ * @brief Function to overwrite every element with a value.
+ * @param nd The n-dimensional array.
+ * @param data Pointer to the value.
+ * Time complexity: O(n)
+ */
+void nd_fill(ndarray* nd, void* data) {
+   // Broadcasting the value to the shape of the array with zero strides.
+   ndarray value = *nd;
+   value.data = data;
+   value.base = NULL;
+   memset(value.strides, 0, sizeof(value.strides));
+   __nd_walk(nd, &value, 0, __nd_visit_copy, &nd->element_size);
+}
+
+/**
+ * @brief Function to copy the elements of an array into another array of the same shape.
+ * @param dest The destination.
+ * @param src The source.
+ * Time complexity: O(n)
+ * @note Contiguous arrays are copied with one memcpy, others tile by tile, so that copying
+ * from or into a transposed view stays cache friendly.
+ */
+void nd_copy(ndarray* dest, ndarray* src) {
+   assert(dest->element_size == src->element_size && "Element sizes differ");
+   if (nd_is_contiguous(dest) && nd_is_contiguous(src)) {
+      __nd_check_same_shape(dest, src);
+      memmove(dest->data, src->data, nd_size(src) * src->element_size);
+      return;
+   }
+   __nd_walk(dest, src, ND_TILE, __nd_visit_copy, &dest->element_size);
+}
+
+/**
+ * @brief Function to transpose a block of a matrix.
+ * @param dest The destination matrix.
+ * @param src The source matrix.
+ * @param row The first row of the block in the source.
+ * @param rows The number of rows of the block.
+ * @param col The first column of the block in the source.
+ * @param cols The number of columns of the block.
+ * Time complexity: O(rows * cols)
+ * @note This function is used internally by the library.
+ */
+void __nd_transpose_block(ndarray* dest, ndarray* src, size_t row, size_t rows, size_t col, size_t cols) {
+   // Halving the longer side until the block is small enough to fit any cache level.
+   if (rows > 16 || cols > 16) {
+      if (rows >= cols) {
+         __nd_transpose_block(dest, src, row, rows / 2, col, cols);
+         __nd_transpose_block(dest, src, row + rows / 2, rows - rows / 2, col, cols);
+      } else {
+         __nd_transpose_block(dest, src, row, rows, col, cols / 2);
+         __nd_transpose_block(dest, src, row, rows, col + cols / 2, cols - cols / 2);
+      }
+      return;
+   }
+   for (size_t i = row; i < row + rows; i++)
+      for (size_t j = col; j < col + cols; j++)
+         memcpy(dest->data + j * dest->strides[0] + i * dest->strides[1],
+                src->data + i * src->strides[0] + j * src->strides[1], src->element_size);
+}
+
+/**
+ * @brief Function to copy the transpose of a matrix.
+ * @param dest The destination, a 2 dimensional array of shape (columns, rows) of the source.
+ * @param src The source, a 2 dimensional array.
+ * Time complexity: O(n)
+ * @note The recursive split keeps both the reads and the writes cache friendly for any cache size.
+ */
+void nd_transpose_into(ndarray* dest, ndarray* src) {
+   assert(dest->ndim == 2 && src->ndim == 2 && "Arrays must be 2 dimensional");
+   assert(dest->shape[0] == src->shape[1] && dest->shape[1] == src->shape[0] && "Shapes do not match");
+   assert(dest->element_size == src->element_size && "Element sizes differ");
+   __nd_transpose_block(dest, src, 0, src->shape[0], 0, src->shape[1]);
+}
+
+/**
+ * @brief Visitor of __nd_walk() folding an element into an accumulator.
+ * @param acc The element of the result.
+ * @param element The element to fold into it.
+ * @param context Pointer to the callback.
+ * Time complexity: O(1)
+ * @note This function is used internally by the library.
+ */
+void __nd_visit_reduce(void* acc, void* element, void* context) {
+   (*(void (**)(void*, void*))context)(acc, element);
+}
+
+/**
+ * @brief Function to reduce an array along an axis.
+ * @param nd The n-dimensional array.
+ * @param axis The axis to reduce.
+ * @param out The result, an array with the shape of `nd` without the axis.
+ * @param init Pointer to the initial value of every element of the result.
+ * @param callback Called with the accumulator in `out` and an element to fold into it.
+ * Time complexity: O(n)
+ * @note The axis is walked in the outer loop, so the inner loops run along the other axes
+ * and stay contiguous for row-major data.
+ */
+void nd_reduce_axis(ndarray* nd, size_t axis, ndarray* out, void* init, void (*callback)(void*, void*)) {
+   assert(axis < nd->ndim && "Axis out of bounds");
+   assert(out->ndim + 1 == nd->ndim && "Result must have one dimension less");
+   nd_fill(out, init);
+   for (size_t k = 0; k < nd->shape[axis]; k++) {
+      ndarray layer = nd_index(nd, axis, k);
+      __nd_walk(out, &layer, 0, __nd_visit_reduce, &callback);
+   }
+}
+
+/**
+ * @brief Function to free the elements owned by the array.
+ * @param nd The n-dimensional array, views own nothing.
+ * Time complexity: O(1)
+ */
+void nd_free(ndarray* nd) {
+   if (nd->base) dsa_free(&nd->allocator, nd->base, nd->base_size);
+   nd->base = NULL;
+   nd->data = NULL;
+   nd->base_size = 0;
+}
+
+#endif // c_dsa_generic_ndarray_c
+
+// End of 'Data Structures/NDArray/ndarray.c'
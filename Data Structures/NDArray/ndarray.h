@@ -0,0 +1,70 @@
+#ifndef c_dsa_generic_ndarray_h
+#define c_dsa_generic_ndarray_h
+
+#include "stddef.h"
+#include "../Array/array.h"
+#include "../../Memory/allocator.h"
+
+// Maximum number of dimensions.
+#define ND_MAX_DIMS 8
+
+// Edge, in elements, of the square tiles used by the tiled functions.
+#ifndef ND_TILE
+#define ND_TILE 32
+#endif
+
+/**
+ * @brief An n-dimensional array of elements, or a view into one.
+ * @var size_t ndim The number of dimensions, 0 for a single element.
+ * @var size_t shape The number of elements along each axis.
+ * @var size_t strides The distance in bytes between two consecutive elements along each axis.
+ * @var size_t element_size The size of each element.
+ * @var void* data Pointer to the element at index (0, ..., 0).
+ * @var void* base The allocation owned by the array, NULL for a view.
+ * @var size_t base_size The size in bytes of the allocation.
+ * @var dsa_allocator allocator The allocator used for the allocation.
+ * @note Slicing and transposing only change shape, strides and data, the elements are never copied.
+ * Views must not outlive the array that owns the elements.
+*/
+typedef struct ndarray {
+   size_t ndim;
+   size_t shape[ND_MAX_DIMS];
+   size_t strides[ND_MAX_DIMS];
+   size_t element_size;
+   void* data;
+   void* base;
+   size_t base_size;
+   dsa_allocator allocator;
+} ndarray;
+
+
+ndarray nd_init_with_allocator(size_t ndim, size_t* shape, size_t element_size, dsa_allocator* allocator);
+ndarray nd_init(size_t ndim, size_t* shape, size_t element_size);
+ndarray nd_from_buffer(void* data, size_t ndim, size_t* shape, size_t element_size);
+ndarray nd_from_array(array* arr, size_t ndim, size_t* shape);
+size_t nd_ndim(ndarray* nd);
+size_t nd_shape(ndarray* nd, size_t axis);
+size_t nd_size(ndarray* nd);
+int nd_is_contiguous(ndarray* nd);
+void* nd_at(ndarray* nd, size_t* index);
+void* nd_at2(ndarray* nd, size_t i, size_t j);
+void* nd_at3(ndarray* nd, size_t i, size_t j, size_t k);
+ndarray nd_slice(ndarray* nd, size_t axis, size_t start, size_t end, size_t step);
+ndarray nd_index(ndarray* nd, size_t axis, size_t index);
+ndarray nd_transpose(ndarray* nd, size_t axis_a, size_t axis_b);
+ndarray nd_permute(ndarray* nd, size_t* axes);
+void __nd_check_same_shape(ndarray* a, ndarray* b);
+void __nd_walk(ndarray* a, ndarray* b, size_t tile, void (*visit)(void*, void*, void*), void* context);
+void __nd_visit_each(void* element, void* unused, void* context);
+void nd_for_each(ndarray* nd, void (*callback)(void*));
+void nd_for_each_tiled(ndarray* nd, void (*callback)(void*));
+void __nd_visit_copy(void* dest, void* src, void* context);
+void nd_fill(ndarray* nd, void* data);
+void nd_copy(ndarray* dest, ndarray* src);
+void __nd_transpose_block(ndarray* dest, ndarray* src, size_t row, size_t rows, size_t col, size_t cols);
+void nd_transpose_into(ndarray* dest, ndarray* src);
+void __nd_visit_reduce(void* acc, void* element, void* context);
+void nd_reduce_axis(ndarray* nd, size_t axis, ndarray* out, void* init, void (*callback)(void*, void*));
+void nd_free(ndarray* nd);
+
+#endif // c_dsa_generic_ndarray_h
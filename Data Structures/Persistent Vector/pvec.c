@@ -0,0 +1,593 @@
+/**
+ * Library for a persistent vector.
+ * Author : Abinash Karmakar
+ * 2023-09-01 MIT License Version: 1.0
+ */
+
+#ifndef c_dsa_generic_pvec_c
+#define c_dsa_generic_pvec_c
+
+#include "pvec.h"
+
+#include "../Vector/vector.c"  // TODO: Remove this
+#include "assert.h"
+#include "stdlib.h"
+#include "string.h"
+
+/**
+ * @brief Factory function for creating an empty persistent vector with a custom allocator.
+ * @param element_size The size of each element.
+ * @param allocator The allocator used for the nodes, NULL for malloc.
+ * @return The empty version, it allocates nothing.
+ * Time complexity: O(1)
+ * @note Every version derived from this one allocates its nodes with the same allocator.
+ */
+pvec pvec_init_with_allocator(size_t element_size, dsa_allocator* allocator) {
+   pvec vec;
+   vec.size = 0;
+   vec.element_size = element_size;
+   vec.shift = PVEC_BITS;
+   vec.root = NULL;
+   vec.tail = NULL;
+   vec.transient = 0;
+   vec.allocator = allocator ? *allocator : dsa_default_allocator();
+   return vec;
+}
+
+/**
+ * @brief Factory function for creating an empty persistent vector.
+ * @param element_size The size of each element.
+ * @return The empty version, it allocates nothing.
+ * Time complexity: O(1)
+ */
+pvec pvec_init(size_t element_size) {
+   return pvec_init_with_allocator(element_size, NULL);
+}
+
+/**
+ * @brief Function to get an empty version using the same allocator as another one.
+ * @param vec The version.
+ * @return The empty version.
+ * Time complexity: O(1)
+ * @note This function is used internally by the library.
+ */
+pvec __pvec_empty_like(pvec* vec) {
+   return pvec_init_with_allocator(vec->element_size, &vec->allocator);
+}
+
+/**
+ * @brief Function to get another handle to the same version.
+ * @param vec The version.
+ * @return The copy, to be released with pvec_free() on its own.
+ * Time complexity: O(1)
+ */
+pvec pvec_copy(pvec* vec) {
+   pvec copy = *vec;
+   if (copy.root) copy.root->refs++;
+   if (copy.tail) copy.tail->refs++;
+   copy.transient = 0;
+   return copy;
+}
+
+/**
+ * @brief Function to get the number of elements.
+ * @param vec The version.
+ * @return The number of elements.
+ * Time complexity: O(1)
+ */
+size_t pvec_size(pvec* vec) {
+   return vec->size;
+}
+
+/**
+ * @brief Function to check if the version is empty.
+ * @param vec The version.
+ * @return 1 if empty, 0 otherwise.
+ * Time complexity: O(1)
+ */
+int pvec_empty(pvec* vec) {
+   return vec->size == 0;
+}
+
+/**
+ * @brief Function to get the size of the allocation of a node.
+ * @param vec The version.
+ * @param level The level of the node, 0 for a leaf.
+ * @return The number of bytes.
+ * Time complexity: O(1)
+ * @note This function is used internally by the library.
+ */
+size_t __pvec_node_bytes(pvec* vec, size_t level) {
+   return offsetof(pvec_node, slots) + (level ? PVEC_WIDTH * sizeof(pvec_node*) : PVEC_WIDTH * vec->element_size);
+}
+
+/**
+ * @brief Function to allocate a node with one reference.
+ * @param vec The version, its allocator is used.
+ * @param level The level of the node, 0 for a leaf.
+ * @return The node, the children of an internal node are NULL.
+ * Time complexity: O(1)
+ * @note This function is used internally by the library.
+ */
+pvec_node* __pvec_node_alloc(pvec* vec, size_t level) {
+   size_t bytes = __pvec_node_bytes(vec, level) - offsetof(pvec_node, slots);
+   pvec_node* node = dsa_alloc(&vec->allocator, __pvec_node_bytes(vec, level));
+   assert(node && "Not Enough Memory!");
+   node->refs = 1;
+   if (level) memset(node->slots, 0, bytes);
+   return node;
+}
+
+/**
+ * @brief Function to get the children of an internal node.
+ * @param node The node.
+ * @return The PVEC_WIDTH children, NULL where there is none.
+ * Time complexity: O(1)
+ * @note This function is used internally by the library.
+ */
+pvec_node** __pvec_children(pvec_node* node) {
+   return (pvec_node**)node->slots;
+}
+
+/**
+ * @brief Function to drop a reference to a node, freeing the subtree nobody else uses.
+ * @param vec The version, its allocator is used.
+ * @param node The node, may be NULL.
+ * @param level The level of the node, 0 for a leaf.
+ * Time complexity: O(1), O(size of the subtree) when it is freed
+ * @note This function is used internally by the library.
+ */
+void __pvec_node_release(pvec* vec, pvec_node* node, size_t level) {
+   if (node == NULL || --node->refs > 0) return;
+   if (level)
+      for (size_t i = 0; i < PVEC_WIDTH; i++)
+         __pvec_node_release(vec, __pvec_children(node)[i], level - PVEC_BITS);
+   dsa_free(&vec->allocator, node, __pvec_node_bytes(vec, level));
+}
+
+/**
+ * @brief Function to get a node that can be written in place.
+ * @param vec The version, its allocator is used.
+ * @param node The node, the caller's reference to it is consumed.
+ * @param level The level of the node, 0 for a leaf.
+ * @return The node itself if no one else references it, otherwise a copy sharing its children.
+ * Time complexity: O(PVEC_WIDTH)
+ * @note This function is used internally by the library.
+ */
+pvec_node* __pvec_editable(pvec* vec, pvec_node* node, size_t level) {
+   if (node->refs == 1) return node;
+   pvec_node* copy = __pvec_node_alloc(vec, level);
+   if (level) {
+      for (size_t i = 0; i < PVEC_WIDTH; i++) {
+         pvec_node* child = __pvec_children(node)[i];
+         if (child) child->refs++;
+         __pvec_children(copy)[i] = child;
+      }
+   } else {
+      memcpy(copy->slots, node->slots, PVEC_WIDTH * vec->element_size);
+   }
+   node->refs--;
+   return copy;
+}
+
+/**
+ * @brief Function to get the index of the first element of the tail.
+ * @param size The number of elements.
+ * @return The number of elements stored in the trie.
+ * Time complexity: O(1)
+ * @note This function is used internally by the library.
+ */
+size_t __pvec_tail_offset(size_t size) {
+   return size < PVEC_WIDTH ? 0 : ((size - 1) >> PVEC_BITS) << PVEC_BITS;
+}
+
+/**
+ * @brief Function to get the leaf holding an element.
+ * @param vec The version.
+ * @param index The index of the element.
+ * @return The leaf, the element is at `index & PVEC_MASK` in it.
+ * Time complexity: O(log32 n)
+ * @note This function is used internally by the library.
+ */
+pvec_node* __pvec_leaf_for(pvec* vec, size_t index) {
+   if (index >= __pvec_tail_offset(vec->size)) return vec->tail;
+   pvec_node* node = vec->root;
+   for (size_t level = vec->shift; level > 0; level -= PVEC_BITS)
+      node = __pvec_children(node)[(index >> level) & PVEC_MASK];
+   return node;
+}
+
+/**
+ * @brief Function to get a read only pointer to an element.
+ * @param vec The version.
+ * @param index The index.
+ * @return A pointer to the element, valid while the version is alive.
+ * Time complexity: O(log32 n)
+ */
+const void* pvec_at(pvec* vec, size_t index) {
+   assert(index < vec->size && "Index out of bounds");
+   return (void*)__pvec_leaf_for(vec, index)->slots + (index & PVEC_MASK) * vec->element_size;
+}
+
+/**
+ * @brief Function to call a callback on every element.
+ * @param vec The version.
+ * @param callback The callback, called with a read only pointer to the element.
+ * Time complexity: O(n)
+ */
+void pvec_for_each(pvec* vec, void (*callback)(const void*)) {
+   for (size_t i = 0; i < vec->size; i += PVEC_WIDTH) {
+      void* leaf = __pvec_leaf_for(vec, i)->slots;
+      size_t count = vec->size - i < PVEC_WIDTH ? vec->size - i : PVEC_WIDTH;
+      for (size_t j = 0; j < count; j++)
+         callback(leaf + j * vec->element_size);
+   }
+}
+
+/**
+ * @brief Function to start a batch of in place updates on a version.
+ * @param vec The version, left unchanged.
+ * @return A transient to update with the pvec_t_* functions and to close with pvec_persistent().
+ * Time complexity: O(1)
+ * @note A transient copies each shared node once, then writes it in place, so a batch of k updates
+ * costs far less than k persistent updates.
+ */
+pvec pvec_transient(pvec* vec) {
+   assert(!vec->transient && "Vector is already transient");
+   pvec transient = pvec_copy(vec);
+   transient.transient = 1;
+   return transient;
+}
+
+/**
+ * @brief Function to turn a transient back into an immutable version.
+ * @param vec The transient, unusable afterwards.
+ * @return The version.
+ * Time complexity: O(1)
+ */
+pvec pvec_persistent(pvec* vec) {
+   assert(vec->transient && "Vector is not transient");
+   pvec version = *vec;
+   version.transient = 0;
+   *vec = __pvec_empty_like(vec);
+   return version;
+}
+
+/**
+ * @brief Function to overwrite an element of a transient.
+ * @param vec The transient.
+ * @param index The index.
+ * @param data Pointer to the new value.
+ * Time complexity: O(log32 n)
+ */
+void pvec_t_set(pvec* vec, size_t index, void* data) {
+   assert(vec->transient && "Vector is not transient");
+   assert(index < vec->size && "Index out of bounds");
+   pvec_node* leaf;
+   if (index >= __pvec_tail_offset(vec->size)) {
+      leaf = vec->tail = __pvec_editable(vec, vec->tail, 0);
+   } else {
+      // Copying the shared nodes on the path down to the leaf.
+      leaf = vec->root = __pvec_editable(vec, vec->root, vec->shift);
+      for (size_t level = vec->shift; level > 0; level -= PVEC_BITS) {
+         pvec_node** slot = &__pvec_children(leaf)[(index >> level) & PVEC_MASK];
+         leaf = *slot = __pvec_editable(vec, *slot, level - PVEC_BITS);
+      }
+   }
+   memcpy((void*)leaf->slots + (index & PVEC_MASK) * vec->element_size, data, vec->element_size);
+}
+
+/**
+ * @brief Function to build the chain of nodes leading down to a leaf.
+ * @param vec The version, its allocator is used.
+ * @param level The level of the top node.
+ * @param leaf The leaf.
+ * @return The top node.
+ * Time complexity: O(log32 n)
+ * @note This function is used internally by the library.
+ */
+pvec_node* __pvec_new_path(pvec* vec, size_t level, pvec_node* leaf) {
+   if (level == 0) return leaf;
+   pvec_node* node = __pvec_node_alloc(vec, level);
+   __pvec_children(node)[0] = __pvec_new_path(vec, level - PVEC_BITS, leaf);
+   return node;
+}
+
+/**
+ * @brief Function to add a full leaf after the last leaf of the trie.
+ * @param vec The transient, its size is the number of elements including the leaf.
+ * @param parent The node at `level`, the caller's reference to it is consumed.
+ * @param level The level of the parent.
+ * @param leaf The leaf.
+ * @return The parent, or its copy.
+ * Time complexity: O(log32 n)
+ * @note This function is used internally by the library.
+ */
+pvec_node* __pvec_push_tail(pvec* vec, pvec_node* parent, size_t level, pvec_node* leaf) {
+   parent = __pvec_editable(vec, parent, level);
+   pvec_node** children = __pvec_children(parent);
+   size_t index = ((vec->size - 1) >> level) & PVEC_MASK;
+   if (level == PVEC_BITS)
+      children[index] = leaf;
+   else if (children[index])
+      children[index] = __pvec_push_tail(vec, children[index], level - PVEC_BITS, leaf);
+   else
+      children[index] = __pvec_new_path(vec, level - PVEC_BITS, leaf);
+   return parent;
+}
+
+/**
+ * @brief Function to add an element at the end of a transient.
+ * @param vec The transient.
+ * @param data Pointer to the value.
+ * Time complexity: O(1) amortized, O(log32 n) when the tail moves into the trie
+ */
+void pvec_t_push_back(pvec* vec, void* data) {
+   assert(vec->transient && "Vector is not transient");
+   if (vec->tail == NULL) {
+      vec->tail = __pvec_node_alloc(vec, 0);
+   } else if (vec->size - __pvec_tail_offset(vec->size) < PVEC_WIDTH) {
+      vec->tail = __pvec_editable(vec, vec->tail, 0);
+   } else {
+      // The tail is full, it becomes the last leaf of the trie.
+      pvec_node* leaf = vec->tail;
+      if (vec->root == NULL) {
+         vec->root = __pvec_new_path(vec, PVEC_BITS, leaf);
+         vec->shift = PVEC_BITS;
+      } else if ((vec->size >> PVEC_BITS) > ((size_t)1 << vec->shift)) {
+         // The trie is full, adding a level above the root.
+         pvec_node* root = __pvec_node_alloc(vec, vec->shift + PVEC_BITS);
+         __pvec_children(root)[0] = vec->root;
+         __pvec_children(root)[1] = __pvec_new_path(vec, vec->shift, leaf);
+         vec->root = root;
+         vec->shift += PVEC_BITS;
+      } else {
+         vec->root = __pvec_push_tail(vec, vec->root, vec->shift, leaf);
+      }
+      vec->tail = __pvec_node_alloc(vec, 0);
+   }
+   memcpy((void*)vec->tail->slots + (vec->size & PVEC_MASK) * vec->element_size, data, vec->element_size);
+   vec->size++;
+}
+
+/**
+ * @brief Function to remove the last leaf of the trie.
+ * @param vec The transient, its size still counts the element being removed.
+ * @param node The node at `level`, the caller's reference to it is consumed.
+ * @param level The level of the node.
+ * @return The node, or its copy, NULL if it became empty.
+ * Time complexity: O(log32 n)
+ * @note This function is used internally by the library.
+ */
+pvec_node* __pvec_pop_tail(pvec* vec, pvec_node* node, size_t level) {
+   node = __pvec_editable(vec, node, level);
+   pvec_node** children = __pvec_children(node);
+   size_t index = ((vec->size - 2) >> level) & PVEC_MASK;
+   if (level > PVEC_BITS) {
+      children[index] = __pvec_pop_tail(vec, children[index], level - PVEC_BITS);
+   } else {
+      __pvec_node_release(vec, children[index], 0);
+      children[index] = NULL;
+   }
+   if (index == 0 && children[0] == NULL) {
+      __pvec_node_release(vec, node, level);
+      return NULL;
+   }
+   return node;
+}
+
+/**
+ * @brief Function to remove the last element of a transient.
+ * @param vec The transient.
+ * Time complexity: O(1) amortized, O(log32 n) when the last leaf of the trie becomes the tail
+ */
+void pvec_t_pop_back(pvec* vec) {
+   assert(vec->transient && "Vector is not transient");
+   assert(vec->size > 0 && "Vector is empty");
+   if (vec->size == 1) {
+      __pvec_node_release(vec, vec->tail, 0);
+      vec->tail = NULL;
+   } else if (vec->size - __pvec_tail_offset(vec->size) == 1) {
+      // The tail becomes empty, the last leaf of the trie takes its place.
+      pvec_node* leaf = __pvec_leaf_for(vec, vec->size - 2);
+      leaf->refs++;
+      __pvec_node_release(vec, vec->tail, 0);
+      vec->tail = leaf;
+      vec->root = __pvec_pop_tail(vec, vec->root, vec->shift);
+      if (vec->root == NULL) {
+         vec->shift = PVEC_BITS;
+      } else if (vec->shift > PVEC_BITS && __pvec_children(vec->root)[1] == NULL) {
+         // Removing a level once the root has a single child.
+         pvec_node* child = __pvec_children(vec->root)[0];
+         child->refs++;
+         __pvec_node_release(vec, vec->root, vec->shift);
+         vec->root = child;
+         vec->shift -= PVEC_BITS;
+      }
+   }
+   vec->size--;
+}
+
+/**
+ * @brief Function to get a version with one element changed.
+ * @param vec The version, left unchanged.
+ * @param index The index.
+ * @param data Pointer to the new value.
+ * @return The new version, sharing every node but the path to the element.
+ * Time complexity: O(log32 n)
+ */
+pvec pvec_set(pvec* vec, size_t index, void* data) {
+   pvec transient = pvec_transient(vec);
+   pvec_t_set(&transient, index, data);
+   return pvec_persistent(&transient);
+}
+
+/**
+ * @brief Function to get a version with an element added at the end.
+ * @param vec The version, left unchanged.
+ * @param data Pointer to the value.
+ * @return The new version.
+ * Time complexity: O(log32 n)
+ */
+pvec pvec_push_back(pvec* vec, void* data) {
+   pvec transient = pvec_transient(vec);
+   pvec_t_push_back(&transient, data);
+   return pvec_persistent(&transient);
+}
+
+/**
+ * @brief Function to get a version without the last element.
+ * @param vec The version, left unchanged.
+ * @return The new version.
+ * Time complexity: O(log32 n)
+ */
+pvec pvec_pop_back(pvec* vec) {
+   pvec transient = pvec_transient(vec);
+   pvec_t_pop_back(&transient);
+   return pvec_persistent(&transient);
+}
+
+/**
+ * @brief Function to copy the path of the trie down to an element, dropping what follows it.
+ * @param vec The version, its allocator is used.
+ * @param node The node.
+ * @param level The level of the node.
+ * @param last The index of the last element to keep.
+ * @return A new node sharing the children before the path.
+ * Time complexity: O(log32 n)
+ * @note This function is used internally by the library.
+ */
+pvec_node* __pvec_trim(pvec* vec, pvec_node* node, size_t level, size_t last) {
+   pvec_node* copy = __pvec_node_alloc(vec, level);
+   size_t index = (last >> level) & PVEC_MASK;
+   for (size_t i = 0; i < index; i++) {
+      __pvec_children(copy)[i] = __pvec_children(node)[i];
+      __pvec_children(copy)[i]->refs++;
+   }
+   pvec_node* child = __pvec_children(node)[index];
+   if (level == PVEC_BITS) {
+      child->refs++;
+      __pvec_children(copy)[index] = child;
+   } else {
+      __pvec_children(copy)[index] = __pvec_trim(vec, child, level - PVEC_BITS, last);
+   }
+   return copy;
+}
+
+/**
+ * @brief Function to get the version made of the first `n` elements.
+ * @param vec The version, left unchanged.
+ * @param n The number of elements to keep.
+ * @return The new version, sharing every node but the path to the last element.
+ * Time complexity: O(log32 n)
+ */
+pvec pvec_take(pvec* vec, size_t n) {
+   assert(!vec->transient && "Vector is transient");
+   assert(n <= vec->size && "Index out of bounds");
+   if (n == vec->size) return pvec_copy(vec);
+   pvec result = __pvec_empty_like(vec);
+   if (n == 0) return result;
+   result.size = n;
+   result.tail = __pvec_leaf_for(vec, n - 1);
+   result.tail->refs++;
+   size_t tail_offset = __pvec_tail_offset(n);
+   if (tail_offset > 0) {
+      // Skipping the levels that are not needed to hold the remaining leaves.
+      pvec_node* node = vec->root;
+      size_t shift = vec->shift;
+      while (shift > PVEC_BITS && ((tail_offset - 1) >> shift) == 0) {
+         node = __pvec_children(node)[0];
+         shift -= PVEC_BITS;
+      }
+      result.root = __pvec_trim(vec, node, shift, tail_offset - 1);
+      result.shift = shift;
+   }
+   return result;
+}
+
+/**
+ * @brief Function to get the version made of the elements in [start, end).
+ * @param vec The version, left unchanged.
+ * @param start The index of the first element.
+ * @param end The index past the last element.
+ * @return The new version.
+ * Time complexity: O(log32 n) for a prefix, O(end - start) otherwise
+ * @note Prefixes share the trie, other slices are rebuilt leaf by leaf.
+ */
+pvec pvec_slice(pvec* vec, size_t start, size_t end) {
+   assert(start <= end && end <= vec->size && "Index out of bounds");
+   if (start == 0) return pvec_take(vec, end);
+   pvec empty = __pvec_empty_like(vec);
+   pvec transient = pvec_transient(&empty);
+   for (size_t i = start; i < end;) {
+      void* leaf = __pvec_leaf_for(vec, i)->slots;
+      size_t stop = (i | PVEC_MASK) + 1 < end ? (i | PVEC_MASK) + 1 : end;
+      for (; i < stop; i++)
+         pvec_t_push_back(&transient, leaf + (i & PVEC_MASK) * vec->element_size);
+   }
+   return pvec_persistent(&transient);
+}
+
+/**
+ * @brief Function to get the version made of two versions one after the other.
+ * @param left The first version, left unchanged.
+ * @param right The second version, left unchanged.
+ * @return The new version, sharing the trie of `left`.
+ * Time complexity: O(m), m is the size of `right`
+ */
+pvec pvec_concat(pvec* left, pvec* right) {
+   assert(left->element_size == right->element_size && "Element sizes differ");
+   pvec transient = pvec_transient(left);
+   for (size_t i = 0; i < right->size; i += PVEC_WIDTH) {
+      void* leaf = __pvec_leaf_for(right, i)->slots;
+      size_t count = right->size - i < PVEC_WIDTH ? right->size - i : PVEC_WIDTH;
+      for (size_t j = 0; j < count; j++)
+         pvec_t_push_back(&transient, leaf + j * right->element_size);
+   }
+   return pvec_persistent(&transient);
+}
+
+/**
+ * @brief Function to create a version holding a copy of a vector.
+ * @param vec The vector.
+ * @return The version, using the allocator of the vector.
+ * Time complexity: O(n)
+ */
+pvec pvec_from_vector(vector* vec) {
+   pvec empty = pvec_init_with_allocator(vec->element_size, &vec->allocator);
+   pvec transient = pvec_transient(&empty);
+   for (size_t i = 0; i < vec->size; i++)
+      pvec_t_push_back(&transient, vec->data + i * vec->element_size);
+   return pvec_persistent(&transient);
+}
+
+/**
+ * @brief Function to copy a version into a new vector.
+ * @param vec The version.
+ * @return A vector with the elements of the version, using the allocator of the version.
+ * Time complexity: O(n)
+ */
+vector pvec_to_vector(pvec* vec) {
+   vector result = vec_init_with_allocator(0, vec->element_size, NULL, &vec->allocator);
+   vec_reserve(&result, vec->size);
+   for (size_t i = 0; i < vec->size; i += PVEC_WIDTH) {
+      size_t count = vec->size - i < PVEC_WIDTH ? vec->size - i : PVEC_WIDTH;
+      vec_append_n(&result, __pvec_leaf_for(vec, i)->slots, count);
+   }
+   return result;
+}
+
+/**
+ * @brief Function to release a version or a transient.
+ * @param vec The version.
+ * Time complexity: O(1), plus the nodes no other version uses
+ */
+void pvec_free(pvec* vec) {
+   __pvec_node_release(vec, vec->root, vec->shift);
+   __pvec_node_release(vec, vec->tail, 0);
+   *vec = __pvec_empty_like(vec);
+}
+
+#endif // c_dsa_generic_pvec_c
+
+// End of 'Data Structures/Persistent Vector/pvec.c'
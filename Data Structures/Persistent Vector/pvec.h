@@ -0,0 +1,80 @@
+#ifndef c_dsa_generic_pvec_h
+#define c_dsa_generic_pvec_h
+
+#include "stddef.h"
+#include "../Vector/vector.h"
+
+// Every node of the trie has 1 << PVEC_BITS children, or elements for the leaves.
+#define PVEC_BITS 5
+#define PVEC_WIDTH (1 << PVEC_BITS)
+#define PVEC_MASK (PVEC_WIDTH - 1)
+
+/**
+ * @brief A node of the persistent vector trie, shared by every version that did not modify it.
+ * @var size_t refs The number of parents and versions pointing to the node.
+ * @var max_align_t slots The children for an internal node, the elements for a leaf.
+*/
+typedef struct pvec_node {
+   size_t refs;
+   max_align_t slots[];
+} pvec_node;
+
+/**
+ * @brief A persistent vector: operations return a new version and never change the old one.
+ * @var size_t size The number of elements.
+ * @var size_t element_size The size of each element.
+ * @var size_t shift The level of the root, a multiple of PVEC_BITS.
+ * @var pvec_node* root The trie holding the elements before the tail, NULL if there is none.
+ * @var pvec_node* tail The leaf holding the last 1 to PVEC_WIDTH elements, NULL if empty.
+ * @var int transient Set by pvec_transient(), the pvec_t_* functions change the vector in place.
+ * @var dsa_allocator allocator The allocator used for the nodes, shared by every version derived from this one.
+ * @note Versions share every node they have in common, an update copies O(log32 n) nodes.
+ * Every version must be released with pvec_free().
+ * @note Reference counts are not atomic, versions must not be shared between threads.
+*/
+typedef struct pvec {
+   size_t size;
+   size_t element_size;
+   size_t shift;
+   pvec_node* root;
+   pvec_node* tail;
+   int transient;
+   dsa_allocator allocator;
+} pvec;
+
+
+pvec pvec_init_with_allocator(size_t element_size, dsa_allocator* allocator);
+pvec pvec_init(size_t element_size);
+pvec __pvec_empty_like(pvec* vec);
+pvec pvec_copy(pvec* vec);
+size_t pvec_size(pvec* vec);
+int pvec_empty(pvec* vec);
+size_t __pvec_node_bytes(pvec* vec, size_t level);
+pvec_node* __pvec_node_alloc(pvec* vec, size_t level);
+pvec_node** __pvec_children(pvec_node* node);
+void __pvec_node_release(pvec* vec, pvec_node* node, size_t level);
+pvec_node* __pvec_editable(pvec* vec, pvec_node* node, size_t level);
+size_t __pvec_tail_offset(size_t size);
+pvec_node* __pvec_leaf_for(pvec* vec, size_t index);
+const void* pvec_at(pvec* vec, size_t index);
+void pvec_for_each(pvec* vec, void (*callback)(const void*));
+pvec pvec_transient(pvec* vec);
+pvec pvec_persistent(pvec* vec);
+void pvec_t_set(pvec* vec, size_t index, void* data);
+pvec_node* __pvec_new_path(pvec* vec, size_t level, pvec_node* leaf);
+pvec_node* __pvec_push_tail(pvec* vec, pvec_node* parent, size_t level, pvec_node* leaf);
+void pvec_t_push_back(pvec* vec, void* data);
+pvec_node* __pvec_pop_tail(pvec* vec, pvec_node* node, size_t level);
+void pvec_t_pop_back(pvec* vec);
+pvec pvec_set(pvec* vec, size_t index, void* data);
+pvec pvec_push_back(pvec* vec, void* data);
+pvec pvec_pop_back(pvec* vec);
+pvec_node* __pvec_trim(pvec* vec, pvec_node* node, size_t level, size_t last);
+pvec pvec_take(pvec* vec, size_t n);
+pvec pvec_slice(pvec* vec, size_t start, size_t end);
+pvec pvec_concat(pvec* left, pvec* right);
+pvec pvec_from_vector(vector* vec);
+vector pvec_to_vector(pvec* vec);
+void pvec_free(pvec* vec);
+
+#endif // c_dsa_generic_pvec_h
@@ -0,0 +1,372 @@
+/**
+ * Library for a vector with small buffer optimization.
+ * Author : Abinash Karmakar
+ * 2023-09-01 MIT License Version: 1.0
+ */
+
+#ifndef c_dsa_generic_sbo_vector_c
+#define c_dsa_generic_sbo_vector_c
+
+#include "sbo_vector.h"
+
+#include "../Vector/vector.c"  // TODO: Remove this
+#include "assert.h"
+
+/**
+ * @brief Function to point the data of the vector back to the embedded buffer.
+ * @param sbo The small buffer vector.
+ * Time complexity: O(1)
+ * @note Needed because the struct may have been copied since the last call.
+ * @note This function is used internally by the library.
+ */
+void __sbo_bind(sbo_vector* sbo) {
+   if (sbo->vec.storage == VEC_STORAGE_INLINE) sbo->vec.data = sbo->inline_data.bytes;
+}
+
+/**
+ * @brief Factory function for creating a small buffer vector.
+ * @param element_size The size of each element in the vector.
+ * @param destroyer The function that will be called when elements are removed from the vector.
+ * @return An empty vector using the embedded buffer.
+ * @note If one element does not fit in the embedded buffer, the vector behaves like a normal vector.
+ * Time complexity: O(1)
+ */
+sbo_vector sbo_init_with_destroyer(size_t element_size, void (*destroyer)(void*)) {
+   return sbo_init_with_allocator(element_size, destroyer, NULL);
+}
+
+/**
+ * @brief Factory function for creating a small buffer vector using a custom allocator.
+ * @param element_size The size of each element in the vector.
+ * @param destroyer The function that will be called when elements are removed from the vector.
+ * @param allocator The allocator used once the vector outgrows the embedded buffer, NULL for malloc.
+ * @return An empty vector using the embedded buffer.
+ * @note If one element does not fit in the embedded buffer, the vector behaves like a normal vector.
+ * Time complexity: O(1)
+ */
+sbo_vector sbo_init_with_allocator(size_t element_size, void (*destroyer)(void*), dsa_allocator* allocator) {
+   sbo_vector sbo;
+   sbo.vec = vec_init_with_allocator(0, element_size, destroyer, allocator);
+   size_t inline_capacity = SBO_VECTOR_INLINE_BYTES / element_size;
+   if (inline_capacity > 0) {
+      sbo.vec.storage = VEC_STORAGE_INLINE;
+      sbo.vec.capacity = inline_capacity;
+      sbo.vec.data = sbo.inline_data.bytes;
+   }
+   return sbo;
+}
+
+/**
+ * @brief Factory function for creating a small buffer vector.
+ * @param element_size The size of each element in the vector.
+ * @return An empty vector using the embedded buffer.
+ * @note The destroyer is set to NULL.
+ * Time complexity: O(1)
+ */
+sbo_vector sbo_init(size_t element_size) {
+   return sbo_init_with_destroyer(element_size, NULL);
+}
+
+/**
+ * @brief Function to get the underlying vector.
+ * @param sbo The small buffer vector.
+ * @return A pointer to the vector, usable with every vec_* function.
+ * Time complexity: O(1)
+ * @warning Call it again after the small buffer vector is copied or moved.
+ */
+vector* sbo_view(sbo_vector* sbo) {
+   __sbo_bind(sbo);
+   return &sbo->vec;
+}
+
+/**
+ * @brief Function to get the number of elements the embedded buffer can hold.
+ * @param sbo The small buffer vector.
+ * @return The inline capacity.
+ * Time complexity: O(1)
+ */
+size_t sbo_inline_capacity(sbo_vector* sbo) {
+   return SBO_VECTOR_INLINE_BYTES / sbo->vec.element_size;
+}
+
+/**
+ * @brief Function to check if the data is still in the embedded buffer.
+ * @param sbo The small buffer vector.
+ * @return 1 if the data is inline, 0 if it moved to the heap.
+ * Time complexity: O(1)
+ */
+int sbo_is_inline(sbo_vector* sbo) {
+   return sbo->vec.storage == VEC_STORAGE_INLINE;
+}
+
+/**
+ * @brief Function to get the size of the vector.
+ * @param sbo The small buffer vector.
+ * @return The size of the vector.
+ * Time complexity: O(1)
+ */
+size_t sbo_size(sbo_vector* sbo) {
+   return sbo->vec.size;
+}
+
+/**
+ * @brief Function to get the capacity of the vector.
+ * @param sbo The small buffer vector.
+ * @return The capacity of the vector.
+ * Time complexity: O(1)
+ */
+size_t sbo_capacity(sbo_vector* sbo) {
+   return sbo->vec.capacity;
+}
+
+/**
+ * @brief Function to check if the vector is empty.
+ * @param sbo The small buffer vector.
+ * @return 1 if the vector is empty, 0 otherwise.
+ * Time complexity: O(1)
+ */
+int sbo_empty(sbo_vector* sbo) {
+   return sbo->vec.size == 0;
+}
+
+/**
+ * @brief Function to get void pointer to the first element of the vector.
+ * @param sbo The small buffer vector.
+ * @return A void pointer to the first element of the vector.
+ * Time complexity: O(1)
+ */
+void* sbo_begin(sbo_vector* sbo) {
+   return vec_begin(sbo_view(sbo));
+}
+
+/**
+ * @brief Function to get void pointer past the last element of the vector.
+ * @param sbo The small buffer vector.
+ * @return A void pointer past the last element of the vector.
+ * Time complexity: O(1)
+ */
+void* sbo_end(sbo_vector* sbo) {
+   return vec_end(sbo_view(sbo));
+}
+
+/**
+ * @brief Function to get void pointer to the first element of the vector.
+ * @param sbo The small buffer vector.
+ * @return A void pointer to the first element of the vector.
+ * Time complexity: O(1)
+ */
+void* sbo_front(sbo_vector* sbo) {
+   return vec_front(sbo_view(sbo));
+}
+
+/**
+ * @brief Function to get void pointer to the last element of the vector.
+ * @param sbo The small buffer vector.
+ * @return A void pointer to the last element of the vector.
+ * Time complexity: O(1)
+ */
+void* sbo_back(sbo_vector* sbo) {
+   return vec_back(sbo_view(sbo));
+}
+
+/**
+ * @brief Function to get the void pointer to the element at the given index.
+ * @param sbo The small buffer vector.
+ * @param index The index of the element, negative indexes count from the end.
+ * @return A void pointer to the element at the given index.
+ * Time complexity: O(1)
+ */
+void* sbo_at(sbo_vector* sbo, int index) {
+   return vec_at(sbo_view(sbo), index);
+}
+
+/**
+ * @brief Function to push the data to the end of the vector.
+ * @param sbo The small buffer vector.
+ * @param data The data to push.
+ * Time complexity: O(1)
+ * @note The data moves to the heap when the embedded buffer is full.
+ */
+void sbo_push_back(sbo_vector* sbo, void* data) {
+   vec_push_back(sbo_view(sbo), data);
+}
+
+/**
+ * @brief Function to reserve one uninitialized slot at the end of the vector.
+ * @param sbo The small buffer vector.
+ * @return A void pointer to the new last element, to be constructed in place by the caller.
+ * Time complexity: O(1)
+ */
+void* sbo_emplace_back(sbo_vector* sbo) {
+   return vec_emplace_back(sbo_view(sbo));
+}
+
+/**
+ * @brief Function to remove the last element from the vector.
+ * @param sbo The small buffer vector.
+ * Time complexity: O(1)
+ */
+void sbo_pop_back(sbo_vector* sbo) {
+   vec_pop_back(sbo_view(sbo));
+}
+
+/**
+ * @brief Function to insert the data at the given index.
+ * @param sbo The small buffer vector.
+ * @param index The index to insert at, in the range [0, size].
+ * @param data The data to insert.
+ * Time complexity: O(n)
+ */
+void sbo_insert(sbo_vector* sbo, size_t index, void* data) {
+   vector* vec = sbo_view(sbo);
+   assert(index <= vec->size && "Index out of bounds");
+   vec_insert(vec, vec->data + index * vec->element_size, data);
+}
+
+/**
+ * @brief Function to erase the element at the given index.
+ * @param sbo The small buffer vector.
+ * @param index The index of the element.
+ * Time complexity: O(n)
+ */
+void sbo_erase(sbo_vector* sbo, size_t index) {
+   vec_erase(sbo_view(sbo), vec_at(sbo_view(sbo), index));
+}
+
+/**
+ * @brief Function to reserve the vector to the given size.
+ * @param sbo The small buffer vector.
+ * @param size The new capacity of the vector.
+ * Time complexity: O(n)
+ */
+void sbo_reserve(sbo_vector* sbo, size_t size) {
+   vec_reserve(sbo_view(sbo), size);
+}
+
+/**
+ * @brief Function to release unused memory.
+ * @param sbo The small buffer vector.
+ * Time complexity: O(n)
+ * @note If the elements fit in the embedded buffer again, they are moved back and the heap buffer
+ * or the mapping is released.
+ */
+void sbo_shrink_to_fit(sbo_vector* sbo) {
+   vector* vec = sbo_view(sbo);
+   size_t inline_capacity = sbo_inline_capacity(sbo);
+   if (vec->storage == VEC_STORAGE_INLINE) return;
+   if (vec->size > inline_capacity) {
+      vec_shrink_to_fit(vec);
+      return;
+   }
+   memcpy(sbo->inline_data.bytes, vec->data, vec->size * vec->element_size);
+   // Releasing the old buffer the way it was obtained, large vectors may live in a mapping.
+   if (vec->storage == VEC_STORAGE_HEAP)
+      dsa_free_aligned(&vec->allocator, vec->data, __vec_alloc_bytes(vec, vec->capacity), vec->alignment);
+   else
+      __vec_mmap_reserve(vec, 0);
+   vec->storage = VEC_STORAGE_INLINE;
+   vec->data = sbo->inline_data.bytes;
+   vec->capacity = inline_capacity;
+}
+
+/**
+ * @brief Function to delete all the elements in the vector, keeping its memory.
+ * @param sbo The small buffer vector.
+ * Time complexity: O(n)
+ */
+void sbo_clear(sbo_vector* sbo) {
+   vec_clear(sbo_view(sbo));
+}
+
+/**
+ * @brief Function to destroy the vector fully.
+ * @param sbo The small buffer vector.
+ * Time complexity: O(n)
+ */
+void sbo_free(sbo_vector* sbo) {
+   vec_free(sbo_view(sbo));
+}
+
+/**
+ * @brief Function to call a callback function for each element in the vector.
+ * @param sbo The small buffer vector.
+ * @param callback The callback function.
+ * Time complexity: O(n)
+ */
+void sbo_for_each(sbo_vector* sbo, void (*callback)(void*)) {
+   vec_for_each(sbo_view(sbo), callback);
+}
+
+/**
+ * @brief Function to call a callback function for each element in the vector with the index.
+ * @param sbo The small buffer vector.
+ * @param callback The callback function.
+ * Time complexity: O(n)
+ */
+void sbo_for_each_idx(sbo_vector* sbo, void (*callback)(void*, size_t)) {
+   vec_for_each_idx(sbo_view(sbo), callback);
+}
+
+/**
+ * @brief Function to find the first occurrence of a value in the vector.
+ * @param sbo The small buffer vector.
+ * @param data The data to find.
+ * @return A void pointer to the first occurrence, or sbo_end() if not found.
+ * Time complexity: O(n)
+ */
+void* sbo_find(sbo_vector* sbo, void* data) {
+   return vec_find(sbo_view(sbo), data);
+}
+
+/**
+ * @brief Function to find the first element matching a predicate.
+ * @param sbo The small buffer vector.
+ * @param predicate The predicate function.
+ * @return A void pointer to the first match, or sbo_end() if not found.
+ * Time complexity: O(n)
+ */
+void* sbo_find_if(sbo_vector* sbo, int (*predicate)(void*)) {
+   return vec_find_if(sbo_view(sbo), predicate);
+}
+
+/**
+ * @brief Function to fill the vector with a value.
+ * @param sbo The small buffer vector.
+ * @param data The data to fill.
+ * Time complexity: O(n)
+ */
+void sbo_fill(sbo_vector* sbo, void* data) {
+   vec_fill(sbo_view(sbo), data);
+}
+
+/**
+ * @brief Function to reverse the vector.
+ * @param sbo The small buffer vector.
+ * Time complexity: O(n)
+ */
+void sbo_reverse(sbo_vector* sbo) {
+   vec_reverse(sbo_view(sbo));
+}
+
+/**
+ * @brief Function to sort the vector using a comparator function.
+ * @param sbo The small buffer vector.
+ * @param cmp The comparator function.
+ * Time complexity: O(n log n)
+ */
+void sbo_sort_cmp(sbo_vector* sbo, int (*cmp)(void*, void*)) {
+   vec_sort_cmp(sbo_view(sbo), cmp);
+}
+
+/**
+ * @brief Function to sort the vector
+ * @param sbo The small buffer vector.
+ * Time complexity: O(n log n)
+ */
+void sbo_sort(sbo_vector* sbo) {
+   vec_sort(sbo_view(sbo));
+}
+
+#endif // c_dsa_generic_sbo_vector_c
+
+// End of 'Data Structures/SBO Vector/sbo_vector.c'
@@ -0,0 +1,60 @@
+#ifndef c_dsa_generic_sbo_vector_h
+#define c_dsa_generic_sbo_vector_h
+
+#include "stddef.h"
+#include "../Vector/vector.h"
+
+// Number of bytes stored inside the struct before the vector moves its data to the heap.
+#ifndef SBO_VECTOR_INLINE_BYTES
+#define SBO_VECTOR_INLINE_BYTES 128
+#endif
+
+/**
+ * @brief A vector with a small buffer embedded in the struct.
+ * @var vector vec The underlying vector. Use sbo_view() to get a pointer to it.
+ * @var inline_data The embedded buffer, used until the vector outgrows it.
+ * @note Small vectors need no heap allocation at all. The struct can be returned and copied
+ * by value, the data pointer is rebound to the embedded buffer by every sbo_* function.
+*/
+typedef struct sbo_vector {
+   vector vec;
+   union {
+      max_align_t align;
+      unsigned char bytes[SBO_VECTOR_INLINE_BYTES];
+   } inline_data;
+} sbo_vector;
+
+
+sbo_vector sbo_init_with_allocator(size_t element_size, void (*destroyer)(void*), dsa_allocator* allocator);
+sbo_vector sbo_init_with_destroyer(size_t element_size, void (*destroyer)(void*));
+sbo_vector sbo_init(size_t element_size);
+vector* sbo_view(sbo_vector* sbo);
+size_t sbo_inline_capacity(sbo_vector* sbo);
+int sbo_is_inline(sbo_vector* sbo);
+size_t sbo_size(sbo_vector* sbo);
+size_t sbo_capacity(sbo_vector* sbo);
+int sbo_empty(sbo_vector* sbo);
+void* sbo_begin(sbo_vector* sbo);
+void* sbo_end(sbo_vector* sbo);
+void* sbo_front(sbo_vector* sbo);
+void* sbo_back(sbo_vector* sbo);
+void* sbo_at(sbo_vector* sbo, int index);
+void sbo_push_back(sbo_vector* sbo, void* data);
+void* sbo_emplace_back(sbo_vector* sbo);
+void sbo_pop_back(sbo_vector* sbo);
+void sbo_insert(sbo_vector* sbo, size_t index, void* data);
+void sbo_erase(sbo_vector* sbo, size_t index);
+void sbo_reserve(sbo_vector* sbo, size_t size);
+void sbo_shrink_to_fit(sbo_vector* sbo);
+void sbo_clear(sbo_vector* sbo);
+void sbo_free(sbo_vector* sbo);
+void sbo_for_each(sbo_vector* sbo, void (*callback)(void*));
+void sbo_for_each_idx(sbo_vector* sbo, void (*callback)(void*, size_t));
+void* sbo_find(sbo_vector* sbo, void* data);
+void* sbo_find_if(sbo_vector* sbo, int (*predicate)(void*));
+void sbo_fill(sbo_vector* sbo, void* data);
+void sbo_reverse(sbo_vector* sbo);
+void sbo_sort_cmp(sbo_vector* sbo, int (*cmp)(void*, void*));
+void sbo_sort(sbo_vector* sbo);
+
+#endif // c_dsa_generic_sbo_vector_h
@@ -0,0 +1,384 @@
+/**
+ * Library for a segmented vector with stable element addresses.
+ * Author : Abinash Karmakar
+ * 2023-09-01 MIT License Version: 1.0
+ */
+
+#ifndef c_dsa_generic_seg_vector_c
+#define c_dsa_generic_seg_vector_c
+
+#include "seg_vector.h"
+
+#include "../../Algorithms/algorithms.c"  // TODO: Remove this
+#include "../../Algorithms/algorithms.h"
+#include "assert.h"
+#include "string.h"
+
+/**
+ * @brief Factory function for creating a segmented vector with a custom allocator.
+ * @param element_size The size of each element in the vector.
+ * @param destroyer The function that will be called when elements are removed from the vector.
+ * @param allocator The allocator used for the blocks, NULL for malloc.
+ * @return An empty segmented vector, no block is allocated yet.
+ * Time complexity: O(1)
+ */
+seg_vector seg_init_with_allocator(size_t element_size, void (*destroyer)(void*), dsa_allocator* allocator) {
+   seg_vector seg;
+   seg.size = 0;
+   seg.element_size = element_size;
+   seg.block_count = 0;
+   memset(seg.blocks, 0, sizeof(seg.blocks));
+   seg.destroyer = destroyer;
+   seg.allocator = allocator ? *allocator : dsa_default_allocator();
+   return seg;
+}
+
+/**
+ * @brief Factory function for creating a segmented vector.
+ * @param element_size The size of each element in the vector.
+ * @param destroyer The function that will be called when elements are removed from the vector.
+ * @return An empty segmented vector.
+ * Time complexity: O(1)
+ */
+seg_vector seg_init_with_destroyer(size_t element_size, void (*destroyer)(void*)) {
+   return seg_init_with_allocator(element_size, destroyer, NULL);
+}
+
+/**
+ * @brief Factory function for creating a segmented vector.
+ * @param element_size The size of each element in the vector.
+ * @return An empty segmented vector.
+ * Time complexity: O(1)
+ * @note The destroyer is set to NULL.
+ */
+seg_vector seg_init(size_t element_size) {
+   return seg_init_with_destroyer(element_size, NULL);
+}
+
+/**
+ * @brief Function to get the number of elements in the vector.
+ * @param seg The segmented vector.
+ * @return The number of elements.
+ * Time complexity: O(1)
+ */
+size_t seg_size(seg_vector* seg) {
+   return seg->size;
+}
+
+/**
+ * @brief Function to get the number of elements the allocated blocks can hold.
+ * @param seg The segmented vector.
+ * @return The capacity.
+ * Time complexity: O(1)
+ */
+size_t seg_capacity(seg_vector* seg) {
+   // The blocks hold B, 2B, 4B, ... elements, so k blocks hold B * (2^k - 1).
+   return ((size_t)1 << SEG_VECTOR_FIRST_BLOCK_LOG2) * (((size_t)1 << seg->block_count) - 1);
+}
+
+/**
+ * @brief Function to check if the vector is empty.
+ * @param seg The segmented vector.
+ * @return 1 if empty, 0 otherwise.
+ * Time complexity: O(1)
+ */
+int seg_empty(seg_vector* seg) {
+   return seg->size == 0;
+}
+
+/**
+ * @brief Function to get the number of elements of a block.
+ * @param block The index of the block.
+ * @return The number of elements.
+ * Time complexity: O(1)
+ * @note This function is used internally by the library.
+ */
+size_t __seg_block_capacity(size_t block) {
+   return ((size_t)1 << SEG_VECTOR_FIRST_BLOCK_LOG2) << block;
+}
+
+/**
+ * @brief Function to locate an element in the block directory.
+ * @param index The index of the element.
+ * @param offset Set to the index of the element inside its block.
+ * @return The index of the block.
+ * Time complexity: O(1)
+ * @note This function is used internally by the library.
+ */
+size_t __seg_block_of(size_t index, size_t* offset) {
+   // Shifting the index by the first block size makes the block the position of the highest bit.
+   size_t shifted = index + ((size_t)1 << SEG_VECTOR_FIRST_BLOCK_LOG2);
+#if defined(__GNUC__)
+   size_t high = sizeof(unsigned long long) * 8 - 1 - __builtin_clzll(shifted);
+#else
+   size_t high = 0;
+   while (shifted >> (high + 1)) high++;
+#endif
+   *offset = shifted - ((size_t)1 << high);
+   return high - SEG_VECTOR_FIRST_BLOCK_LOG2;
+}
+
+/**
+ * @brief Function to get void pointer to the element at the given index.
+ * @param seg The segmented vector.
+ * @param index The index.
+ * @return A void pointer to the element, valid until the element is removed.
+ * Time complexity: O(1)
+ */
+void* seg_at(seg_vector* seg, size_t index) {
+   assert(index < seg->size && "Index out of bounds");
+   size_t offset;
+   size_t block = __seg_block_of(index, &offset);
+   return seg->blocks[block] + offset * seg->element_size;
+}
+
+/**
+ * @brief Function to get void pointer to the first element.
+ * @param seg The segmented vector.
+ * @return A void pointer to the first element.
+ * Time complexity: O(1)
+ */
+void* seg_front(seg_vector* seg) {
+   return seg_at(seg, 0);
+}
+
+/**
+ * @brief Function to get void pointer to the last element.
+ * @param seg The segmented vector.
+ * @return A void pointer to the last element.
+ * Time complexity: O(1)
+ */
+void* seg_back(seg_vector* seg) {
+   assert(seg->size > 0 && "Vector is empty");
+   return seg_at(seg, seg->size - 1);
+}
+
+/**
+ * @brief Function to get one block as a contiguous range.
+ * @param seg The segmented vector.
+ * @param block The index of the block.
+ * @param count Set to the number of elements in use in the block.
+ * @return A void pointer to the first element of the block.
+ * Time complexity: O(1)
+ * @note [block, block + count * element_size) can be passed to the kernels in algorithms.h.
+ */
+void* seg_block(seg_vector* seg, size_t block, size_t* count) {
+   assert(block < seg->block_count && "Block out of bounds");
+   size_t first = __seg_block_capacity(block) - ((size_t)1 << SEG_VECTOR_FIRST_BLOCK_LOG2);
+   size_t used = seg->size > first ? seg->size - first : 0;
+   *count = used < __seg_block_capacity(block) ? used : __seg_block_capacity(block);
+   return seg->blocks[block];
+}
+
+/**
+ * @brief Function to allocate blocks until the vector can hold `size` elements.
+ * @param seg The segmented vector.
+ * @param size The number of elements.
+ * Time complexity: O(log n)
+ * @note Existing elements are never moved.
+ */
+void seg_reserve(seg_vector* seg, size_t size) {
+   while (seg_capacity(seg) < size) {
+      assert(seg->block_count < SEG_VECTOR_MAX_BLOCKS && "Not Enough Memory!");
+      void* block = dsa_alloc(&seg->allocator, __seg_block_capacity(seg->block_count) * seg->element_size);
+      assert(block && "Not Enough Memory!");
+      seg->blocks[seg->block_count++] = block;
+   }
+}
+
+/**
+ * @brief Function to add an uninitialized element at the end.
+ * @param seg The segmented vector.
+ * @return A void pointer to the new element, to be written by the caller.
+ * Time complexity: O(1)
+ */
+void* seg_emplace_back(seg_vector* seg) {
+   seg_reserve(seg, seg->size + 1);
+   seg->size++;
+   return seg_at(seg, seg->size - 1);
+}
+
+/**
+ * @brief Function to add an element at the end.
+ * @param seg The segmented vector.
+ * @param data Pointer to the element, it is copied.
+ * Time complexity: O(1)
+ */
+void seg_push_back(seg_vector* seg, void* data) {
+   memcpy(seg_emplace_back(seg), data, seg->element_size);
+}
+
+/**
+ * @brief Function to remove the last element.
+ * @param seg The segmented vector.
+ * Time complexity: O(1)
+ * @note The blocks are kept, use seg_shrink_to_fit() to release them.
+ */
+void seg_pop_back(seg_vector* seg) {
+   void* back = seg_back(seg);
+   if (seg->destroyer) seg->destroyer(back);
+   seg->size--;
+}
+
+/**
+ * @brief Function to call a callback on every element with its index.
+ * @param seg The segmented vector.
+ * @param callback The callback, called with a pointer to the element and its index.
+ * Time complexity: O(n)
+ */
+void seg_for_each_idx(seg_vector* seg, void (*callback)(void*, size_t)) {
+   size_t index = 0;
+   for (size_t b = 0; b < seg->block_count && index < seg->size; b++) {
+      size_t count;
+      void* block = seg_block(seg, b, &count);
+      for (size_t i = 0; i < count; i++, index++)
+         callback(block + i * seg->element_size, index);
+   }
+}
+
+/**
+ * @brief Function to call a callback on every element.
+ * @param seg The segmented vector.
+ * @param callback The callback, called with a pointer to the element.
+ * Time complexity: O(n)
+ */
+void seg_for_each(seg_vector* seg, void (*callback)(void*)) {
+   for (size_t b = 0; b < seg->block_count; b++) {
+      size_t count;
+      void* block = seg_block(seg, b, &count);
+      if (count == 0) break;
+      for_each_n(block, count, seg->element_size, callback);
+   }
+}
+
+/**
+ * @brief Function to find the first occurrence of a value.
+ * @param seg The segmented vector.
+ * @param data Pointer to the value, compared with memcmp.
+ * @return The index of the element, or seg_size() if not found.
+ * Time complexity: O(n)
+ */
+size_t seg_find(seg_vector* seg, void* data) {
+   size_t index = 0;
+   for (size_t b = 0; b < seg->block_count; b++) {
+      size_t count;
+      void* block = seg_block(seg, b, &count);
+      void* end = block + count * seg->element_size;
+      void* found = find(block, end, seg->element_size, data);
+      if (found != end) return index + (found - block) / seg->element_size;
+      index += count;
+   }
+   return seg->size;
+}
+
+/**
+ * @brief Function to find the first element that satisfies a predicate.
+ * @param seg The segmented vector.
+ * @param predicate The predicate, called with a pointer to the element.
+ * @return The index of the element, or seg_size() if not found.
+ * Time complexity: O(n)
+ */
+size_t seg_find_if(seg_vector* seg, int (*predicate)(void*)) {
+   size_t index = 0;
+   for (size_t b = 0; b < seg->block_count; b++) {
+      size_t count;
+      void* block = seg_block(seg, b, &count);
+      void* end = block + count * seg->element_size;
+      void* found = find_if(block, end, seg->element_size, predicate);
+      if (found != end) return index + (found - block) / seg->element_size;
+      index += count;
+   }
+   return seg->size;
+}
+
+/**
+ * @brief Function to overwrite every element with a value.
+ * @param seg The segmented vector.
+ * @param data Pointer to the value.
+ * Time complexity: O(n)
+ */
+void seg_fill(seg_vector* seg, void* data) {
+   for (size_t b = 0; b < seg->block_count; b++) {
+      size_t count;
+      void* block = seg_block(seg, b, &count);
+      fill_n(block, count, seg->element_size, data);
+   }
+}
+
+/**
+ * @brief Function to sort the vector with a comparator.
+ * @param seg The segmented vector.
+ * @param cmp The comparator function.
+ * Time complexity: O(n log n)
+ * @note The elements are gathered into one buffer, sorted by sort() and copied back.
+ * Addresses stay valid but now hold other values.
+ */
+void seg_sort_cmp(seg_vector* seg, int (*cmp)(void*, void*)) {
+   if (seg->size <= 1) return;
+   size_t es = seg->element_size;
+   void* temp = dsa_alloc(&seg->allocator, seg->size * es);
+   assert(temp && "Not Enough Memory!");
+   size_t index = 0;
+   for (size_t b = 0; b < seg->block_count && index < seg->size; b++) {
+      size_t count;
+      void* block = seg_block(seg, b, &count);
+      memcpy(temp + index * es, block, count * es);
+      index += count;
+   }
+   sort(temp, temp + seg->size * es, es, cmp);
+   index = 0;
+   for (size_t b = 0; b < seg->block_count && index < seg->size; b++) {
+      size_t count;
+      void* block = seg_block(seg, b, &count);
+      memcpy(block, temp + index * es, count * es);
+      index += count;
+   }
+   dsa_free(&seg->allocator, temp, seg->size * es);
+}
+
+/**
+ * @brief Function to sort the vector of integers.
+ * @param seg The segmented vector.
+ * Time complexity: O(n log n)
+ */
+void seg_sort(seg_vector* seg) {
+   seg_sort_cmp(seg, int_cmp);
+}
+
+/**
+ * @brief Function to free the blocks that hold no element.
+ * @param seg The segmented vector.
+ * Time complexity: O(log n)
+ */
+void seg_shrink_to_fit(seg_vector* seg) {
+   while (seg->block_count > 0 && seg_capacity(seg) - __seg_block_capacity(seg->block_count - 1) >= seg->size) {
+      seg->block_count--;
+      dsa_free(&seg->allocator, seg->blocks[seg->block_count],
+               __seg_block_capacity(seg->block_count) * seg->element_size);
+      seg->blocks[seg->block_count] = NULL;
+   }
+}
+
+/**
+ * @brief Function to remove every element, keeping the blocks.
+ * @param seg The segmented vector.
+ * Time complexity: O(n) with a destroyer, O(1) otherwise
+ */
+void seg_clear(seg_vector* seg) {
+   if (seg->destroyer) seg_for_each(seg, seg->destroyer);
+   seg->size = 0;
+}
+
+/**
+ * @brief Function to destroy the segmented vector fully.
+ * @param seg The segmented vector.
+ * Time complexity: O(n) with a destroyer, O(log n) otherwise
+ */
+void seg_free(seg_vector* seg) {
+   seg_clear(seg);
+   seg_shrink_to_fit(seg);
+}
+
+#endif // c_dsa_generic_seg_vector_c
+
+// End of 'Data Structures/Segmented Vector/seg_vector.c'
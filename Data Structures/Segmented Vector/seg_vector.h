@@ -0,0 +1,64 @@
+#ifndef c_dsa_generic_seg_vector_h
+#define c_dsa_generic_seg_vector_h
+
+#include "stddef.h"
+#include "../../Memory/allocator.h"
+
+// log2 of the number of elements in the first block, must be a power of two.
+#ifndef SEG_VECTOR_FIRST_BLOCK_LOG2
+#define SEG_VECTOR_FIRST_BLOCK_LOG2 4
+#endif
+
+// Number of entries of the block directory, enough to address every size_t index.
+#define SEG_VECTOR_MAX_BLOCKS (64 - SEG_VECTOR_FIRST_BLOCK_LOG2)
+
+/**
+ * @brief A generic vector made of blocks that are never moved.
+ * @var size_t size The number of elements in the vector.
+ * @var size_t element_size The size of each element in the vector.
+ * @var size_t block_count The number of allocated blocks.
+ * @var void* blocks The block directory, block k holds (1 << SEG_VECTOR_FIRST_BLOCK_LOG2) << k elements.
+ * @var void (*destroyer)(void*) A function pointer to a function that destroys the data
+ * allocated by the user in the vector. It is called when an element is removed using library functions.
+ * @var dsa_allocator allocator The allocator used for the blocks.
+ * @note Growing allocates a new block and never copies, so pointers to elements stay valid
+ * until the element is removed.
+*/
+typedef struct seg_vector {
+   size_t size;
+   size_t element_size;
+   size_t block_count;
+   void* blocks[SEG_VECTOR_MAX_BLOCKS];
+   void (*destroyer)(void*);
+   dsa_allocator allocator;
+} seg_vector;
+
+
+seg_vector seg_init_with_allocator(size_t element_size, void (*destroyer)(void*), dsa_allocator* allocator);
+seg_vector seg_init_with_destroyer(size_t element_size, void (*destroyer)(void*));
+seg_vector seg_init(size_t element_size);
+size_t seg_size(seg_vector* seg);
+size_t seg_capacity(seg_vector* seg);
+int seg_empty(seg_vector* seg);
+size_t __seg_block_capacity(size_t block);
+size_t __seg_block_of(size_t index, size_t* offset);
+void* seg_at(seg_vector* seg, size_t index);
+void* seg_front(seg_vector* seg);
+void* seg_back(seg_vector* seg);
+void* seg_block(seg_vector* seg, size_t block, size_t* count);
+void seg_reserve(seg_vector* seg, size_t size);
+void* seg_emplace_back(seg_vector* seg);
+void seg_push_back(seg_vector* seg, void* data);
+void seg_pop_back(seg_vector* seg);
+void seg_for_each_idx(seg_vector* seg, void (*callback)(void*, size_t));
+void seg_for_each(seg_vector* seg, void (*callback)(void*));
+size_t seg_find(seg_vector* seg, void* data);
+size_t seg_find_if(seg_vector* seg, int (*predicate)(void*));
+void seg_fill(seg_vector* seg, void* data);
+void seg_sort_cmp(seg_vector* seg, int (*cmp)(void*, void*));
+void seg_sort(seg_vector* seg);
+void seg_shrink_to_fit(seg_vector* seg);
+void seg_clear(seg_vector* seg);
+void seg_free(seg_vector* seg);
+
+#endif // c_dsa_generic_seg_vector_h
@@ -0,0 +1,365 @@
+/**
+ * Library for copy-on-write vector snapshots.
+ * Author : Abinash Karmakar
+ * 2023-09-01 MIT License Version: 1.0
+ */
+
+#ifndef c_dsa_generic_snap_vector_c
+#define c_dsa_generic_snap_vector_c
+
+#include "snap_vector.h"
+
+#include "../Vector/vector.c"  // TODO: Remove this
+#include "assert.h"
+#include "stdlib.h"
+#include "string.h"
+
+/**
+ * @brief Function to initialize a snapshot vector with an empty version and a custom allocator.
+ * @param snap The snapshot vector.
+ * @param element_size The size of each element.
+ * @param allocator The allocator used for the versions and the blocks, NULL for malloc.
+ * It must be usable from every thread that releases a version.
+ * Time complexity: O(1)
+ * @note The snapshot vector is initialized in place, it must not be copied once shared between threads.
+ */
+void snap_init_with_allocator(snap_vector* snap, size_t element_size, dsa_allocator* allocator) {
+   snap->element_size = element_size;
+   snap->allocator = allocator ? *allocator : dsa_default_allocator();
+   snap->block_elements = SNAP_VECTOR_BLOCK_BYTES / element_size;
+   if (snap->block_elements == 0) snap->block_elements = 1;
+   atomic_init(&snap->readers[0], 0);
+   atomic_init(&snap->readers[1], 0);
+   atomic_init(&snap->epoch, 0);
+   atomic_flag_clear(&snap->writing);
+   atomic_init(&snap->current, __snap_version_alloc(snap, 0));
+}
+
+/**
+ * @brief Function to initialize a snapshot vector with an empty version.
+ * @param snap The snapshot vector.
+ * @param element_size The size of each element.
+ * Time complexity: O(1)
+ * @note The snapshot vector is initialized in place, it must not be copied once shared between threads.
+ */
+void snap_init(snap_vector* snap, size_t element_size) {
+   snap_init_with_allocator(snap, element_size, NULL);
+}
+
+/**
+ * @brief Function to initialize a snapshot vector with a copy of a vector.
+ * @param snap The snapshot vector.
+ * @param vec The vector, its elements become the first version.
+ * Time complexity: O(n)
+ * @note The snapshot vector uses the allocator of the vector.
+ */
+void snap_init_from_vector(snap_vector* snap, vector* vec) {
+   snap_init_with_allocator(snap, vec->element_size, &vec->allocator);
+   snap_draft draft = snap_begin_write(snap);
+   for (size_t i = 0; i < vec->size; i++)
+      snap_draft_push_back(&draft, vec->data + i * vec->element_size);
+   snap_commit(&draft);
+}
+
+/**
+ * @brief Function to take a reference to the current version.
+ * @param snap The snapshot vector.
+ * @return The version, valid and unchanged until snap_release() is called on it.
+ * Time complexity: O(1), plus one retry for each commit that happens during the call
+ * @note Lock-free: never waits for writers or other readers, but retries when a commit flips the epoch
+ * between reading it and announcing the read.
+ */
+snap_version* snap_acquire(snap_vector* snap) {
+   // Announcing the read in the current epoch, so a writer replacing the version waits for us
+   // before dropping its reference.
+   unsigned epoch = atomic_load(&snap->epoch);
+   atomic_fetch_add(&snap->readers[epoch & 1], 1);
+   // A commit that flipped the epoch before the announcement did not wait for it, and the version
+   // loaded next may be retired by the following commit, which waits on the other counter.
+   while (atomic_load(&snap->epoch) != epoch) {
+      atomic_fetch_sub(&snap->readers[epoch & 1], 1);
+      epoch = atomic_load(&snap->epoch);
+      atomic_fetch_add(&snap->readers[epoch & 1], 1);
+   }
+   snap_version* version = atomic_load(&snap->current);
+   atomic_fetch_add(&version->refs, 1);
+   atomic_fetch_sub(&snap->readers[epoch & 1], 1);
+   return version;
+}
+
+/**
+ * @brief Function to drop a reference to a version.
+ * @param version The version.
+ * Time complexity: O(1), O(n / block size) for the last reference
+ * @note The last holder frees the version and the blocks no other version uses.
+ */
+void snap_release(snap_version* version) {
+   if (atomic_fetch_sub(&version->refs, 1) != 1) return;
+   // The allocator is copied out first, it lives in the version being freed.
+   dsa_allocator allocator = version->allocator;
+   for (size_t i = 0; i < version->block_count; i++)
+      if (atomic_fetch_sub(&version->blocks[i]->refs, 1) == 1) __snap_block_free(version, version->blocks[i]);
+   dsa_free(&allocator, version->blocks, version->block_count * sizeof(snap_block*));
+   dsa_free(&allocator, version, sizeof(snap_version));
+}
+
+/**
+ * @brief Function to get the number of elements of a version.
+ * @param version The version.
+ * @return The number of elements.
+ * Time complexity: O(1)
+ */
+size_t snap_size(snap_version* version) {
+   return version->size;
+}
+
+/**
+ * @brief Function to get a read only pointer to an element of a version.
+ * @param version The version.
+ * @param index The index.
+ * @return A pointer to the element, valid while the version is held.
+ * Time complexity: O(1)
+ */
+const void* snap_at(snap_version* version, size_t index) {
+   assert(index < version->size && "Index out of bounds");
+   snap_block* block = version->blocks[index / version->block_elements];
+   return (void*)block->data + (index % version->block_elements) * version->element_size;
+}
+
+/**
+ * @brief Function to call a callback on every element of a version.
+ * @param version The version.
+ * @param callback The callback, called with a read only pointer to the element.
+ * Time complexity: O(n)
+ */
+void snap_for_each(snap_version* version, void (*callback)(const void*)) {
+   size_t remaining = version->size;
+   for (size_t b = 0; b < version->block_count && remaining > 0; b++) {
+      size_t count = remaining < version->block_elements ? remaining : version->block_elements;
+      void* data = version->blocks[b]->data;
+      for (size_t i = 0; i < count; i++)
+         callback(data + i * version->element_size);
+      remaining -= count;
+   }
+}
+
+/**
+ * @brief Function to copy a version into a new vector.
+ * @param version The version.
+ * @return A vector with the elements of the version, using the allocator of the snapshot vector.
+ * Time complexity: O(n)
+ */
+vector snap_to_vector(snap_version* version) {
+   vector vec = vec_init_with_allocator(0, version->element_size, NULL, &version->allocator);
+   vec_reserve(&vec, version->size);
+   size_t remaining = version->size;
+   for (size_t b = 0; b < version->block_count && remaining > 0; b++) {
+      size_t count = remaining < version->block_elements ? remaining : version->block_elements;
+      vec_append_n(&vec, version->blocks[b]->data, count);
+      remaining -= count;
+   }
+   return vec;
+}
+
+/**
+ * @brief Function to get the size of the allocation of a block.
+ * @param version A version of the snapshot vector.
+ * @return The number of bytes.
+ * Time complexity: O(1)
+ * @note This function is used internally by the library.
+ */
+size_t __snap_block_bytes(snap_version* version) {
+   return offsetof(snap_block, data) + version->block_elements * version->element_size;
+}
+
+/**
+ * @brief Function to allocate a block owned by a single version.
+ * @param version The version.
+ * @return The block, with one reference.
+ * Time complexity: O(1)
+ * @note This function is used internally by the library.
+ */
+snap_block* __snap_block_alloc(snap_version* version) {
+   snap_block* block = dsa_alloc(&version->allocator, __snap_block_bytes(version));
+   assert(block && "Not Enough Memory!");
+   atomic_init(&block->refs, 1);
+   return block;
+}
+
+/**
+ * @brief Function to free a block once its last version dropped it.
+ * @param version A version the block belonged to.
+ * @param block The block.
+ * Time complexity: O(1)
+ * @note This function is used internally by the library.
+ */
+void __snap_block_free(snap_version* version, snap_block* block) {
+   dsa_free(&version->allocator, block, __snap_block_bytes(version));
+}
+
+/**
+ * @brief Function to allocate an empty version with room for `block_count` block pointers.
+ * @param snap The snapshot vector.
+ * @param block_count The number of blocks.
+ * @return The version, with one reference.
+ * Time complexity: O(1)
+ * @note This function is used internally by the library.
+ */
+snap_version* __snap_version_alloc(snap_vector* snap, size_t block_count) {
+   snap_version* version = dsa_alloc(&snap->allocator, sizeof(snap_version));
+   assert(version && "Not Enough Memory!");
+   version->allocator = snap->allocator;
+   atomic_init(&version->refs, 1);
+   version->size = 0;
+   version->element_size = snap->element_size;
+   version->block_elements = snap->block_elements;
+   version->block_count = block_count;
+   version->blocks = block_count ? dsa_alloc(&snap->allocator, block_count * sizeof(snap_block*)) : NULL;
+   assert((version->blocks || block_count == 0) && "Not Enough Memory!");
+   return version;
+}
+
+/**
+ * @brief Function to start writing a new version.
+ * @param snap The snapshot vector.
+ * @return A draft sharing every block of the current version.
+ * Time complexity: O(n / block size)
+ * @note Writers are serialized, this waits until the previous draft is committed or aborted.
+ */
+snap_draft snap_begin_write(snap_vector* snap) {
+   while (atomic_flag_test_and_set(&snap->writing))
+      ;
+   // Only writers replace the current version, so it can be read without announcing it.
+   snap_version* current = atomic_load(&snap->current);
+   snap_draft draft;
+   draft.snap = snap;
+   draft.version = __snap_version_alloc(snap, current->block_count);
+   draft.version->size = current->size;
+   for (size_t i = 0; i < current->block_count; i++) {
+      atomic_fetch_add(&current->blocks[i]->refs, 1);
+      draft.version->blocks[i] = current->blocks[i];
+   }
+   return draft;
+}
+
+/**
+ * @brief Function to get a writable pointer to an element of a draft.
+ * @param draft The draft.
+ * @param index The index.
+ * @return A pointer to the element.
+ * Time complexity: O(1), O(block size) when the block is still shared and gets copied
+ */
+void* snap_draft_at(snap_draft* draft, size_t index) {
+   snap_version* version = draft->version;
+   assert(index < version->size && "Index out of bounds");
+   size_t b = index / version->block_elements;
+   snap_block* block = version->blocks[b];
+   // Another version still reads this block, writing goes to a private copy.
+   if (atomic_load(&block->refs) != 1) {
+      snap_block* copy = __snap_block_alloc(version);
+      memcpy(copy->data, block->data, version->block_elements * version->element_size);
+      if (atomic_fetch_sub(&block->refs, 1) == 1) __snap_block_free(version, block);
+      version->blocks[b] = block = copy;
+   }
+   return (void*)block->data + (index % version->block_elements) * version->element_size;
+}
+
+/**
+ * @brief Function to overwrite an element of a draft.
+ * @param draft The draft.
+ * @param index The index.
+ * @param data Pointer to the new value.
+ * Time complexity: O(1), O(block size) when the block is still shared and gets copied
+ */
+void snap_draft_set(snap_draft* draft, size_t index, void* data) {
+   memcpy(snap_draft_at(draft, index), data, draft->version->element_size);
+}
+
+/**
+ * @brief Function to add an element at the end of a draft.
+ * @param draft The draft.
+ * @param data Pointer to the value.
+ * Time complexity: O(1) amortized
+ */
+void snap_draft_push_back(snap_draft* draft, void* data) {
+   snap_version* version = draft->version;
+   if (version->size == version->block_count * version->block_elements) {
+      snap_block** blocks = dsa_realloc(&version->allocator, version->blocks, version->block_count * sizeof(snap_block*),
+                                        (version->block_count + 1) * sizeof(snap_block*));
+      assert(blocks && "Not Enough Memory!");
+      version->blocks = blocks;
+      version->blocks[version->block_count++] = __snap_block_alloc(version);
+   }
+   version->size++;
+   snap_draft_set(draft, version->size - 1, data);
+}
+
+/**
+ * @brief Function to remove the last element of a draft.
+ * @param draft The draft.
+ * Time complexity: O(1), plus shrinking the block table when the last block is dropped
+ */
+void snap_draft_pop_back(snap_draft* draft) {
+   snap_version* version = draft->version;
+   assert(version->size > 0 && "Vector is empty");
+   version->size--;
+   // Dropping the last block once it is unused.
+   if (version->size <= (version->block_count - 1) * version->block_elements) {
+      snap_block* block = version->blocks[--version->block_count];
+      if (atomic_fetch_sub(&block->refs, 1) == 1) __snap_block_free(version, block);
+      // The table stays block_count long, that is the size given back to the allocator.
+      if (version->block_count == 0) {
+         dsa_free(&version->allocator, version->blocks, sizeof(snap_block*));
+         version->blocks = NULL;
+      } else {
+         snap_block** blocks = dsa_realloc(&version->allocator, version->blocks, (version->block_count + 1) * sizeof(snap_block*),
+                                           version->block_count * sizeof(snap_block*));
+         assert(blocks && "Not Enough Memory!");
+         version->blocks = blocks;
+      }
+   }
+}
+
+/**
+ * @brief Function to publish a draft as the current version.
+ * @param draft The draft, unusable afterwards.
+ * Time complexity: O(1), plus the wait for readers that are inside snap_acquire()
+ * @note The previous version is freed once its last reader releases it.
+ */
+void snap_commit(snap_draft* draft) {
+   snap_vector* snap = draft->snap;
+   snap_version* old = atomic_exchange(&snap->current, draft->version);
+   // Readers announced in the old epoch may have loaded `old` without referencing it yet.
+   // New readers use the other counter and can only load the new version.
+   unsigned epoch = atomic_fetch_add(&snap->epoch, 1) & 1;
+   while (atomic_load(&snap->readers[epoch]) != 0)
+      ;
+   snap_release(old);
+   draft->version = NULL;
+   atomic_flag_clear(&snap->writing);
+}
+
+/**
+ * @brief Function to drop a draft without publishing it.
+ * @param draft The draft, unusable afterwards.
+ * Time complexity: O(n / block size)
+ */
+void snap_abort(snap_draft* draft) {
+   snap_release(draft->version);
+   draft->version = NULL;
+   atomic_flag_clear(&draft->snap->writing);
+}
+
+/**
+ * @brief Function to destroy the snapshot vector.
+ * @param snap The snapshot vector.
+ * Time complexity: O(n / block size)
+ * @note Versions still held by readers stay valid until they are released.
+ */
+void snap_free(snap_vector* snap) {
+   snap_release(atomic_exchange(&snap->current, NULL));
+}
+
+#endif // c_dsa_generic_snap_vector_c
+
+// End of 'Data Structures/Snapshot Vector/snap_vector.c'
@@ -0,0 +1,102 @@
+#ifndef c_dsa_generic_snap_vector_h
+#define c_dsa_generic_snap_vector_h
+
+#include "stdatomic.h"
+#include "stddef.h"
+#include "../Vector/vector.h"
+
+// Size in bytes of the blocks that are shared between versions and copied on write.
+#ifndef SNAP_VECTOR_BLOCK_BYTES
+#define SNAP_VECTOR_BLOCK_BYTES 4096
+#endif
+
+/**
+ * @brief A block of elements shared by every version that did not modify it.
+ * @var atomic_size_t refs The number of versions using the block.
+ * @var max_align_t data The elements.
+*/
+typedef struct snap_block {
+   atomic_size_t refs;
+   max_align_t data[];
+} snap_block;
+
+/**
+ * @brief An immutable version of a snapshot vector.
+ * @var atomic_size_t refs The number of holders: readers, the snapshot vector if it is the current one,
+ * the draft while it is written.
+ * @var size_t size The number of elements.
+ * @var size_t element_size The size of each element.
+ * @var size_t block_elements The number of elements of each block.
+ * @var size_t block_count The number of blocks.
+ * @var snap_block** blocks The blocks, possibly shared with other versions.
+ * @var dsa_allocator allocator The allocator of the snapshot vector, kept so the last holder can free
+ * the version after the snapshot vector is gone.
+*/
+typedef struct snap_version {
+   atomic_size_t refs;
+   size_t size;
+   size_t element_size;
+   size_t block_elements;
+   size_t block_count;
+   snap_block** blocks;
+   dsa_allocator allocator;
+} snap_version;
+
+/**
+ * @brief A vector published as refcounted immutable versions.
+ * @var _Atomic(snap_version*) current The latest published version.
+ * @var atomic_size_t readers Readers between loading `current` and taking a reference, per epoch.
+ * @var atomic_uint epoch Selects the reader counter used by new readers.
+ * @var atomic_flag writing Set while a draft is open, writers are serialized.
+ * @var size_t element_size The size of each element.
+ * @var size_t block_elements The number of elements of each block.
+ * @var dsa_allocator allocator The allocator used for the versions and the blocks.
+ * @note Readers never wait for writers: snap_acquire() only retries when a commit flips the epoch
+ * at the same time, snap_release() is a fixed number of atomic operations.
+ * A writer copies only the blocks it modifies, and a version is freed by its last holder.
+ * @note Elements are copied bytewise between versions, so they must not own memory.
+*/
+typedef struct snap_vector {
+   _Atomic(snap_version*) current;
+   atomic_size_t readers[2];
+   atomic_uint epoch;
+   atomic_flag writing;
+   size_t element_size;
+   size_t block_elements;
+   dsa_allocator allocator;
+} snap_vector;
+
+/**
+ * @brief A version being written, private to the writer until snap_commit().
+ * @var snap_vector* snap The snapshot vector it will be published to.
+ * @var snap_version* version The new version.
+*/
+typedef struct snap_draft {
+   snap_vector* snap;
+   snap_version* version;
+} snap_draft;
+
+
+void snap_init_with_allocator(snap_vector* snap, size_t element_size, dsa_allocator* allocator);
+void snap_init(snap_vector* snap, size_t element_size);
+void snap_init_from_vector(snap_vector* snap, vector* vec);
+snap_version* snap_acquire(snap_vector* snap);
+void snap_release(snap_version* version);
+size_t snap_size(snap_version* version);
+const void* snap_at(snap_version* version, size_t index);
+void snap_for_each(snap_version* version, void (*callback)(const void*));
+vector snap_to_vector(snap_version* version);
+size_t __snap_block_bytes(snap_version* version);
+snap_block* __snap_block_alloc(snap_version* version);
+void __snap_block_free(snap_version* version, snap_block* block);
+snap_version* __snap_version_alloc(snap_vector* snap, size_t block_count);
+snap_draft snap_begin_write(snap_vector* snap);
+void* snap_draft_at(snap_draft* draft, size_t index);
+void snap_draft_set(snap_draft* draft, size_t index, void* data);
+void snap_draft_push_back(snap_draft* draft, void* data);
+void snap_draft_pop_back(snap_draft* draft);
+void snap_commit(snap_draft* draft);
+void snap_abort(snap_draft* draft);
+void snap_free(snap_vector* snap);
+
+#endif // c_dsa_generic_snap_vector_h
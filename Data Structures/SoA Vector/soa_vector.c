@@ -0,0 +1,306 @@
+/**
+ * Library for a structure of arrays vector.
+ * Author : Abinash Karmakar
+ * 2023-09-01 MIT License Version: 1.0
+ */
+
+#ifndef c_dsa_generic_soa_vector_c
+#define c_dsa_generic_soa_vector_c
+
+#include "soa_vector.h"
+
+#include "../Vector/vector.c"  // TODO: Remove this
+#include "assert.h"
+
+/**
+ * @brief Factory function for creating a structure of arrays vector with a custom allocator.
+ * @param row_size The size of the row struct, e.g. sizeof(person).
+ * @param fields The schema, one entry per field to store. It is copied.
+ * @param field_count The number of fields.
+ * @param allocator The allocator used for the columns, the schema and the sort buffers, NULL for malloc.
+ * @return An empty vector with one column per field.
+ * @note Bytes of the row struct not covered by a field (e.g. padding) are not stored.
+ * Time complexity: O(k), k is the number of fields
+ */
+soa_vector soa_init_with_allocator(size_t row_size, soa_field* fields, size_t field_count, dsa_allocator* allocator) {
+   assert(field_count > 0 && "At least one field is required");
+   soa_vector soa;
+   soa.size = 0;
+   soa.row_size = row_size;
+   soa.field_count = field_count;
+   soa.allocator = allocator ? *allocator : dsa_default_allocator();
+   soa.fields = dsa_alloc(&soa.allocator, field_count * sizeof(soa_field));
+   soa.columns = dsa_alloc(&soa.allocator, field_count * sizeof(vector));
+   assert(soa.fields && soa.columns && "Not Enough Memory!");
+   for (size_t i = 0; i < field_count; i++) {
+      assert(fields[i].size > 0 && fields[i].offset + fields[i].size <= row_size && "Field out of the row");
+      soa.fields[i] = fields[i];
+      soa.columns[i] = vec_init_with_allocator(0, fields[i].size, NULL, &soa.allocator);
+   }
+   return soa;
+}
+
+/**
+ * @brief Factory function for creating a structure of arrays vector.
+ * @param row_size The size of the row struct, e.g. sizeof(person).
+ * @param fields The schema, one entry per field to store. It is copied.
+ * @param field_count The number of fields.
+ * @return An empty vector with one column per field.
+ * Time complexity: O(k), k is the number of fields
+ */
+soa_vector soa_init(size_t row_size, soa_field* fields, size_t field_count) {
+   return soa_init_with_allocator(row_size, fields, field_count, NULL);
+}
+
+/**
+ * @brief Function to get the number of rows.
+ * @param soa The structure of arrays vector.
+ * @return The number of rows.
+ * Time complexity: O(1)
+ */
+size_t soa_size(soa_vector* soa) {
+   return soa->size;
+}
+
+/**
+ * @brief Function to check if there is no row.
+ * @param soa The structure of arrays vector.
+ * @return 1 if empty, 0 otherwise.
+ * Time complexity: O(1)
+ */
+int soa_empty(soa_vector* soa) {
+   return soa->size == 0;
+}
+
+/**
+ * @brief Function to get the number of fields.
+ * @param soa The structure of arrays vector.
+ * @return The number of fields.
+ * Time complexity: O(1)
+ */
+size_t soa_field_count(soa_vector* soa) {
+   return soa->field_count;
+}
+
+/**
+ * @brief Function to get the column of a field.
+ * @param soa The structure of arrays vector.
+ * @param field The index of the field in the schema.
+ * @return The column, usable with the non modifying vec_* functions (find, for_each, ...).
+ * Time complexity: O(1)
+ * @warning Do not add, remove or reorder elements of a single column, or the rows get out of sync.
+ * Use soa_sort_by_column() to sort.
+ */
+vector* soa_column(soa_vector* soa, size_t field) {
+   assert(field < soa->field_count && "Field out of bounds");
+   return &soa->columns[field];
+}
+
+/**
+ * @brief Function to get void pointer to the first value of a column.
+ * @param soa The structure of arrays vector.
+ * @param field The index of the field in the schema.
+ * @return A void pointer to the value of the field in the first row.
+ * Time complexity: O(1)
+ * @note [soa_column_begin, soa_column_end) is a contiguous range for the kernels in algorithms.h.
+ */
+void* soa_column_begin(soa_vector* soa, size_t field) {
+   return vec_begin(soa_column(soa, field));
+}
+
+/**
+ * @brief Function to get void pointer past the last value of a column.
+ * @param soa The structure of arrays vector.
+ * @param field The index of the field in the schema.
+ * @return A void pointer past the value of the field in the last row.
+ * Time complexity: O(1)
+ */
+void* soa_column_end(soa_vector* soa, size_t field) {
+   return vec_end(soa_column(soa, field));
+}
+
+/**
+ * @brief Function to get void pointer to the value of a field in a row.
+ * @param soa The structure of arrays vector.
+ * @param field The index of the field in the schema.
+ * @param index The index of the row.
+ * @return A void pointer to the value.
+ * Time complexity: O(1)
+ */
+void* soa_at(soa_vector* soa, size_t field, size_t index) {
+   assert(index < soa->size && "Index out of bounds");
+   vector* column = soa_column(soa, field);
+   return column->data + index * column->element_size;
+}
+
+/**
+ * @brief Function to reserve room for `size` rows in every column.
+ * @param soa The structure of arrays vector.
+ * @param size The number of rows.
+ * Time complexity: O(n)
+ */
+void soa_reserve(soa_vector* soa, size_t size) {
+   for (size_t i = 0; i < soa->field_count; i++)
+      vec_reserve(&soa->columns[i], size);
+}
+
+/**
+ * @brief Function to add a row at the end.
+ * @param soa The structure of arrays vector.
+ * @param row Pointer to the row struct, each field is copied into its column.
+ * Time complexity: O(k), k is the number of fields
+ */
+void soa_push_back(soa_vector* soa, void* row) {
+   for (size_t i = 0; i < soa->field_count; i++)
+      memcpy(vec_emplace_back(&soa->columns[i]), row + soa->fields[i].offset, soa->fields[i].size);
+   soa->size++;
+}
+
+/**
+ * @brief Function to copy a row out into a row struct.
+ * @param soa The structure of arrays vector.
+ * @param index The index of the row.
+ * @param row Pointer to the row struct to fill.
+ * Time complexity: O(k), k is the number of fields
+ */
+void soa_get(soa_vector* soa, size_t index, void* row) {
+   for (size_t i = 0; i < soa->field_count; i++)
+      memcpy(row + soa->fields[i].offset, soa_at(soa, i, index), soa->fields[i].size);
+}
+
+/**
+ * @brief Function to overwrite a row from a row struct.
+ * @param soa The structure of arrays vector.
+ * @param index The index of the row.
+ * @param row Pointer to the row struct.
+ * Time complexity: O(k), k is the number of fields
+ */
+void soa_set(soa_vector* soa, size_t index, void* row) {
+   for (size_t i = 0; i < soa->field_count; i++)
+      memcpy(soa_at(soa, i, index), row + soa->fields[i].offset, soa->fields[i].size);
+}
+
+/**
+ * @brief Function to remove the last row.
+ * @param soa The structure of arrays vector.
+ * Time complexity: O(k), k is the number of fields
+ */
+void soa_pop_back(soa_vector* soa) {
+   assert(soa->size > 0 && "Vector is empty");
+   for (size_t i = 0; i < soa->field_count; i++)
+      vec_pop_back(&soa->columns[i]);
+   soa->size--;
+}
+
+/**
+ * @brief Function to remove a row, keeping the order of the other rows.
+ * @param soa The structure of arrays vector.
+ * @param index The index of the row.
+ * Time complexity: O(n * k), k is the number of fields
+ */
+void soa_erase(soa_vector* soa, size_t index) {
+   assert(index < soa->size && "Index out of bounds");
+   for (size_t i = 0; i < soa->field_count; i++)
+      vec_erase(&soa->columns[i], soa_at(soa, i, index));
+   soa->size--;
+}
+
+/**
+ * @brief Function to find the first row whose field equals a value.
+ * @param soa The structure of arrays vector.
+ * @param field The index of the field in the schema.
+ * @param value Pointer to the value, compared with memcmp.
+ * @return The index of the row, or soa_size() if not found.
+ * Time complexity: O(n), only the column of the field is read
+ */
+size_t soa_find(soa_vector* soa, size_t field, void* value) {
+   vector* column = soa_column(soa, field);
+   void* found = vec_find(column, value);
+   return (found - column->data) / column->element_size;
+}
+
+/**
+ * @brief Function to reorder every column so that row i becomes the old row order[i].
+ * @param soa The structure of arrays vector.
+ * @param order The permutation, soa_size() row indexes.
+ * Time complexity: O(n * k), k is the number of fields
+ * @note This function is used internally by the library.
+ */
+void __soa_permute(soa_vector* soa, size_t* order) {
+   size_t largest = 0;
+   for (size_t i = 0; i < soa->field_count; i++)
+      if (soa->fields[i].size > largest) largest = soa->fields[i].size;
+   void* temp = dsa_alloc(&soa->allocator, soa->size * largest);
+   assert((temp || soa->size == 0) && "Not Enough Memory!");
+   // Gathering each column into the scratch buffer, then copying it back in one go.
+   for (size_t i = 0; i < soa->field_count; i++) {
+      vector* column = &soa->columns[i];
+      size_t element_size = column->element_size;
+      for (size_t j = 0; j < soa->size; j++)
+         memcpy(temp + j * element_size, column->data + order[j] * element_size, element_size);
+      memcpy(column->data, temp, soa->size * element_size);
+   }
+   dsa_free(&soa->allocator, temp, soa->size * largest);
+}
+
+/**
+ * @brief Function to sort the rows by the value of one field.
+ * @param soa The structure of arrays vector.
+ * @param field The index of the field in the schema.
+ * @param cmp The comparator function, called with pointers to two values of the field.
+ * Time complexity: O(n log n + n * k), k is the number of fields
+ * @note The keys are sorted together with their row index by the kernels of sorting.h,
+ * then every column is permuted once.
+ */
+void soa_sort_by_column(soa_vector* soa, size_t field, int (*cmp)(void*, void*)) {
+   vector* column = soa_column(soa, field);
+   size_t n = soa->size;
+   if (n <= 1) return;
+   // Each record is the key followed by its row index, so `cmp` still sees a pointer to the key.
+   size_t key_size = dsa_align_up(column->element_size, _Alignof(size_t));
+   size_t record_size = key_size + sizeof(size_t);
+   void* records = dsa_alloc(&soa->allocator, n * record_size);
+   size_t* order = dsa_alloc(&soa->allocator, n * sizeof(size_t));
+   assert(records && order && "Not Enough Memory!");
+   for (size_t i = 0; i < n; i++) {
+      memcpy(records + i * record_size, column->data + i * column->element_size, column->element_size);
+      *(size_t*)(records + i * record_size + key_size) = i;
+   }
+   sort(records, records + n * record_size, record_size, cmp);
+   for (size_t i = 0; i < n; i++)
+      order[i] = *(size_t*)(records + i * record_size + key_size);
+   __soa_permute(soa, order);
+   dsa_free(&soa->allocator, records, n * record_size);
+   dsa_free(&soa->allocator, order, n * sizeof(size_t));
+}
+
+/**
+ * @brief Function to remove every row, keeping the memory.
+ * @param soa The structure of arrays vector.
+ * Time complexity: O(k), k is the number of fields
+ */
+void soa_clear(soa_vector* soa) {
+   for (size_t i = 0; i < soa->field_count; i++)
+      vec_clear(&soa->columns[i]);
+   soa->size = 0;
+}
+
+/**
+ * @brief Function to destroy the structure of arrays vector fully.
+ * @param soa The structure of arrays vector.
+ * Time complexity: O(k), k is the number of fields
+ */
+void soa_free(soa_vector* soa) {
+   for (size_t i = 0; i < soa->field_count; i++)
+      vec_free(&soa->columns[i]);
+   dsa_free(&soa->allocator, soa->columns, soa->field_count * sizeof(vector));
+   dsa_free(&soa->allocator, soa->fields, soa->field_count * sizeof(soa_field));
+   soa->columns = NULL;
+   soa->fields = NULL;
+   soa->field_count = 0;
+   soa->size = 0;
+}
+
+#endif // c_dsa_generic_soa_vector_c
+
+// End of 'Data Structures/SoA Vector/soa_vector.c'
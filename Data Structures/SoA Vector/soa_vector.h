@@ -0,0 +1,61 @@
+#ifndef c_dsa_generic_soa_vector_h
+#define c_dsa_generic_soa_vector_h
+
+#include "stddef.h"
+#include "../Vector/vector.h"
+
+/**
+ * @brief Describes one field of the rows stored in a soa_vector.
+ * @var size_t offset Offset of the field in the row struct.
+ * @var size_t size Size of the field.
+*/
+typedef struct soa_field {
+   size_t offset;
+   size_t size;
+} soa_field;
+
+// Schema entry for `member` of the struct `type`, e.g. SOA_FIELD(person, age)
+#define SOA_FIELD(type, member) ((soa_field){ offsetof(type, member), sizeof(((type*)0)->member) })
+
+/**
+ * @brief A vector of rows stored as one contiguous column per field (structure of arrays).
+ * @var size_t size The number of rows.
+ * @var size_t row_size The size of the row struct accepted by soa_push_back() and soa_get().
+ * @var size_t field_count The number of fields, and of columns.
+ * @var soa_field* fields The schema of the rows.
+ * @var vector* columns One vector per field, the i-th element of every column is the i-th row.
+ * @var dsa_allocator allocator The allocator used for the columns, the schema and the sort buffers.
+ * @note Scanning one field only touches that column, the other fields stay out of the cache.
+*/
+typedef struct soa_vector {
+   size_t size;
+   size_t row_size;
+   size_t field_count;
+   soa_field* fields;
+   vector* columns;
+   dsa_allocator allocator;
+} soa_vector;
+
+
+soa_vector soa_init_with_allocator(size_t row_size, soa_field* fields, size_t field_count, dsa_allocator* allocator);
+soa_vector soa_init(size_t row_size, soa_field* fields, size_t field_count);
+size_t soa_size(soa_vector* soa);
+int soa_empty(soa_vector* soa);
+size_t soa_field_count(soa_vector* soa);
+vector* soa_column(soa_vector* soa, size_t field);
+void* soa_column_begin(soa_vector* soa, size_t field);
+void* soa_column_end(soa_vector* soa, size_t field);
+void* soa_at(soa_vector* soa, size_t field, size_t index);
+void soa_reserve(soa_vector* soa, size_t size);
+void soa_push_back(soa_vector* soa, void* row);
+void soa_get(soa_vector* soa, size_t index, void* row);
+void soa_set(soa_vector* soa, size_t index, void* row);
+void soa_pop_back(soa_vector* soa);
+void soa_erase(soa_vector* soa, size_t index);
+size_t soa_find(soa_vector* soa, size_t field, void* value);
+void __soa_permute(soa_vector* soa, size_t* order);
+void soa_sort_by_column(soa_vector* soa, size_t field, int (*cmp)(void*, void*));
+void soa_clear(soa_vector* soa);
+void soa_free(soa_vector* soa);
+
+#endif // c_dsa_generic_soa_vector_h
@@ -0,0 +1,326 @@
+/**
+ * Library for non owning views over arrays, vectors and buffers.
+ * Author : Abinash Karmakar
+ * 2023-09-01 MIT License Version: 1.0
+ */
+
+#ifndef c_dsa_generic_span_c
+#define c_dsa_generic_span_c
+
+#include "span.h"
+
+#include "../Vector/vector.c"  // TODO: Remove this
+#include "assert.h"
+#include "string.h"
+
+/**
+ * @brief Function to view a contiguous buffer.
+ * @param data Pointer to the first element.
+ * @param count The number of elements.
+ * @param element_size The size of each element.
+ * @return The span.
+ * Time complexity: O(1)
+ */
+dsa_span span_from_buffer(void* data, size_t count, size_t element_size) {
+   return span_from_strided(data, count, element_size, element_size);
+}
+
+/**
+ * @brief Function to view elements placed at a fixed distance from each other.
+ * @param data Pointer to the first element.
+ * @param count The number of elements.
+ * @param element_size The size of each element.
+ * @param stride The distance in bytes between two elements, at least element_size.
+ * @return The span.
+ * Time complexity: O(1)
+ */
+dsa_span span_from_strided(void* data, size_t count, size_t element_size, size_t stride) {
+   assert(stride >= element_size && "Stride must be at least the element size");
+   dsa_span span;
+   span.data = data;
+   span.count = count;
+   span.element_size = element_size;
+   span.stride = stride;
+   return span;
+}
+
+/**
+ * @brief Function to view one field of every struct of a buffer, see SPAN_FIELD.
+ * @param data Pointer to the first struct.
+ * @param count The number of structs.
+ * @param struct_size The size of each struct.
+ * @param offset The offset of the field in the struct.
+ * @param field_size The size of the field.
+ * @return The span, with a stride of struct_size.
+ * Time complexity: O(1)
+ */
+dsa_span span_from_field(void* data, size_t count, size_t struct_size, size_t offset, size_t field_size) {
+   assert(offset + field_size <= struct_size && "Field out of the struct");
+   return span_from_strided(data + offset, count, field_size, struct_size);
+}
+
+/**
+ * @brief Function to view every element of an array.
+ * @param arr The array.
+ * @return The span.
+ * Time complexity: O(1)
+ */
+dsa_span span_from_array(array* arr) {
+   return span_from_buffer(arr->data, arr->size, arr->element_size);
+}
+
+/**
+ * @brief Function to view every element of a vector.
+ * @param vec The vector.
+ * @return The span, invalidated when the vector reallocates.
+ * Time complexity: O(1)
+ */
+dsa_span span_from_vector(vector* vec) {
+   return span_from_buffer(vec->data, vec->size, vec->element_size);
+}
+
+/**
+ * @brief Function to view a part of a span.
+ * @param span The span.
+ * @param start The index of the first element.
+ * @param count The number of elements.
+ * @return The span of [start, start + count).
+ * Time complexity: O(1)
+ */
+dsa_span span_subspan(dsa_span span, size_t start, size_t count) {
+   assert(start <= span.count && count <= span.count - start && "Range out of bounds");
+   span.data += start * span.stride;
+   span.count = count;
+   return span;
+}
+
+/**
+ * @brief Function to view every `step`-th element of a span.
+ * @param span The span.
+ * @param step The step, 1 keeps every element.
+ * @return The strided span.
+ * Time complexity: O(1)
+ */
+dsa_span span_every(dsa_span span, size_t step) {
+   assert(step > 0 && "Step must be positive");
+   span.count = (span.count + step - 1) / step;
+   span.stride *= step;
+   return span;
+}
+
+/**
+ * @brief Function to get the number of elements.
+ * @param span The span.
+ * @return The number of elements.
+ * Time complexity: O(1)
+ */
+size_t span_size(dsa_span span) {
+   return span.count;
+}
+
+/**
+ * @brief Function to check if the span has no element.
+ * @param span The span.
+ * @return 1 if empty, 0 otherwise.
+ * Time complexity: O(1)
+ */
+int span_empty(dsa_span span) {
+   return span.count == 0;
+}
+
+/**
+ * @brief Function to check if the elements are next to each other.
+ * @param span The span.
+ * @return 1 if contiguous, 0 if strided.
+ * Time complexity: O(1)
+ */
+int span_is_contiguous(dsa_span span) {
+   return span.stride == span.element_size;
+}
+
+/**
+ * @brief Function to get void pointer to an element.
+ * @param span The span.
+ * @param index The index.
+ * @return A void pointer to the element.
+ * Time complexity: O(1)
+ */
+void* span_at(dsa_span span, size_t index) {
+   assert(index < span.count && "Index out of bounds");
+   return span.data + index * span.stride;
+}
+
+/**
+ * @brief Function to get void pointer to the first element.
+ * @param span The span.
+ * @return A void pointer to the first element.
+ * Time complexity: O(1)
+ */
+void* span_begin(dsa_span span) {
+   return span.data;
+}
+
+/**
+ * @brief Function to get void pointer past the last element.
+ * @param span The span.
+ * @return A void pointer past the last element.
+ * Time complexity: O(1)
+ * @note For a contiguous span, [span_begin, span_end) can be passed to the kernels in algorithms.h.
+ */
+void* span_end(dsa_span span) {
+   return span.data + span.count * span.stride;
+}
+
+/**
+ * @brief Function to call a callback on every element with its index.
+ * @param span The span.
+ * @param callback The callback.
+ * Time complexity: O(n)
+ */
+void span_for_each_idx(dsa_span span, void (*callback)(void*, size_t)) {
+   if (span_is_contiguous(span)) {
+      for_each_n_idx(span.data, span.count, span.element_size, callback);
+      return;
+   }
+   for (size_t i = 0; i < span.count; i++)
+      callback(span.data + i * span.stride, i);
+}
+
+/**
+ * @brief Function to call a callback on every element.
+ * @param span The span.
+ * @param callback The callback.
+ * Time complexity: O(n)
+ */
+void span_for_each(dsa_span span, void (*callback)(void*)) {
+   if (span_is_contiguous(span)) {
+      for_each_n(span.data, span.count, span.element_size, callback);
+      return;
+   }
+   for (size_t i = 0; i < span.count; i++)
+      callback(span.data + i * span.stride);
+}
+
+/**
+ * @brief Function to find the first occurrence of a value.
+ * @param span The span.
+ * @param data Pointer to the value, compared with memcmp.
+ * @return The index of the element, or span_size() if not found.
+ * Time complexity: O(n)
+ */
+size_t span_find(dsa_span span, void* data) {
+   if (span_is_contiguous(span))
+      return (find_n(span.data, span.count, span.element_size, data) - span.data) / span.element_size;
+   for (size_t i = 0; i < span.count; i++)
+      if (memcmp(span.data + i * span.stride, data, span.element_size) == 0) return i;
+   return span.count;
+}
+
+/**
+ * @brief Function to find the first element that satisfies a predicate.
+ * @param span The span.
+ * @param predicate The predicate.
+ * @return The index of the element, or span_size() if not found.
+ * Time complexity: O(n)
+ */
+size_t span_find_if(dsa_span span, int (*predicate)(void*)) {
+   if (span_is_contiguous(span))
+      return (find_if_n(span.data, span.count, span.element_size, predicate) - span.data) / span.element_size;
+   for (size_t i = 0; i < span.count; i++)
+      if (predicate(span.data + i * span.stride)) return i;
+   return span.count;
+}
+
+/**
+ * @brief Function to overwrite every element with a value.
+ * @param span The span.
+ * @param data Pointer to the value.
+ * Time complexity: O(n)
+ */
+void span_fill(dsa_span span, void* data) {
+   if (span_is_contiguous(span)) {
+      fill_n(span.data, span.count, span.element_size, data);
+      return;
+   }
+   for (size_t i = 0; i < span.count; i++)
+      memcpy(span.data + i * span.stride, data, span.element_size);
+}
+
+/**
+ * @brief Function to reverse the order of the elements.
+ * @param span The span.
+ * Time complexity: O(n)
+ */
+void span_reverse(dsa_span span) {
+   if (span_is_contiguous(span)) {
+      reverse_n(span.data, span.count, span.element_size);
+      return;
+   }
+   for (size_t i = 0, j = span.count; i + 1 < j; i++, j--)
+      swap(span.data + i * span.stride, span.data + (j - 1) * span.stride, span.element_size);
+}
+
+/**
+ * @brief Function to sort the elements with a comparator, allocating the temporary with an allocator.
+ * @param span The span.
+ * @param cmp The comparator function.
+ * @param allocator The allocator for the buffer of a strided span, NULL for malloc.
+ * Time complexity: O(n log n)
+ * @note A strided span is gathered into a contiguous buffer, sorted, then scattered back.
+ * The rest of the viewed structs does not move.
+ */
+void span_sort_cmp_with_allocator(dsa_span span, int (*cmp)(void*, void*), dsa_allocator* allocator) {
+   if (span_is_contiguous(span)) {
+      sort(span.data, span_end(span), span.element_size, cmp);
+      return;
+   }
+   if (span.count <= 1) return;
+   void* temp = dsa_alloc(allocator, span.count * span.element_size);
+   assert(temp && "Not Enough Memory!");
+   dsa_span buffer = span_from_buffer(temp, span.count, span.element_size);
+   span_copy(buffer, span);
+   sort(temp, span_end(buffer), span.element_size, cmp);
+   span_copy(span, buffer);
+   dsa_free(allocator, temp, span.count * span.element_size);
+}
+
+/**
+ * @brief Function to sort the elements with a comparator.
+ * @param span The span.
+ * @param cmp The comparator function.
+ * Time complexity: O(n log n)
+ * @note The buffer of a strided span is allocated with malloc, see span_sort_cmp_with_allocator().
+ */
+void span_sort_cmp(dsa_span span, int (*cmp)(void*, void*)) {
+   span_sort_cmp_with_allocator(span, cmp, NULL);
+}
+
+/**
+ * @brief Function to sort the elements of a span of integers.
+ * @param span The span.
+ * Time complexity: O(n log n)
+ */
+void span_sort(dsa_span span) {
+   span_sort_cmp(span, int_cmp);
+}
+
+/**
+ * @brief Function to copy the elements of a span into another one.
+ * @param dest The destination span, at least as long as the source.
+ * @param src The source span, with the same element size.
+ * Time complexity: O(n)
+ */
+void span_copy(dsa_span dest, dsa_span src) {
+   assert(dest.element_size == src.element_size && "Element sizes differ");
+   assert(dest.count >= src.count && "Destination is too small");
+   if (span_is_contiguous(dest) && span_is_contiguous(src)) {
+      memmove(dest.data, src.data, src.count * src.element_size);
+      return;
+   }
+   for (size_t i = 0; i < src.count; i++)
+      memcpy(dest.data + i * dest.stride, src.data + i * src.stride, src.element_size);
+}
+
+#endif // c_dsa_generic_span_c
+
+// End of 'Data Structures/Span/span.c'
@@ -0,0 +1,53 @@
+#ifndef c_dsa_generic_span_h
+#define c_dsa_generic_span_h
+
+#include "stddef.h"
+#include "../Array/array.h"
+#include "../Vector/vector.h"
+
+/**
+ * @brief A non owning view over elements in memory owned by someone else.
+ * @var void* data Pointer to the first element.
+ * @var size_t count The number of elements.
+ * @var size_t element_size The size of each element.
+ * @var size_t stride The distance in bytes between two elements, equal to element_size when contiguous.
+ * @note A span is invalidated by anything that moves or frees the memory it views,
+ * e.g. a vector growing.
+*/
+typedef struct dsa_span {
+   void* data;
+   size_t count;
+   size_t element_size;
+   size_t stride;
+} dsa_span;
+
+// Strided span over `member` of `count` structs of type `type` starting at `ptr`
+#define SPAN_FIELD(ptr, count, type, member) \
+   span_from_field((ptr), (count), sizeof(type), offsetof(type, member), sizeof(((type*)0)->member))
+
+
+dsa_span span_from_buffer(void* data, size_t count, size_t element_size);
+dsa_span span_from_strided(void* data, size_t count, size_t element_size, size_t stride);
+dsa_span span_from_field(void* data, size_t count, size_t struct_size, size_t offset, size_t field_size);
+dsa_span span_from_array(array* arr);
+dsa_span span_from_vector(vector* vec);
+dsa_span span_subspan(dsa_span span, size_t start, size_t count);
+dsa_span span_every(dsa_span span, size_t step);
+size_t span_size(dsa_span span);
+int span_empty(dsa_span span);
+int span_is_contiguous(dsa_span span);
+void* span_at(dsa_span span, size_t index);
+void* span_begin(dsa_span span);
+void* span_end(dsa_span span);
+void span_for_each_idx(dsa_span span, void (*callback)(void*, size_t));
+void span_for_each(dsa_span span, void (*callback)(void*));
+size_t span_find(dsa_span span, void* data);
+size_t span_find_if(dsa_span span, int (*predicate)(void*));
+void span_fill(dsa_span span, void* data);
+void span_reverse(dsa_span span);
+void span_sort_cmp_with_allocator(dsa_span span, int (*cmp)(void*, void*), dsa_allocator* allocator);
+void span_sort_cmp(dsa_span span, int (*cmp)(void*, void*));
+void span_sort(dsa_span span);
+void span_copy(dsa_span dest, dsa_span src);
+
+#endif // c_dsa_generic_span_h
@@ -5,8 +5,8 @@
 */
 
 #include "./stack.h"
-#include "../Vector/vector.h"
-#include "../Vector/vector.c" // TODO: Remove this when the library is complete
+#include "../SBO Vector/sbo_vector.h"
+#include "../SBO Vector/sbo_vector.c" // TODO: Remove this when the library is complete
 
 /**
  * @brief Initializes a stack with a destroyer function
@@ -16,7 +16,20 @@
 */
 stack stk_init_with_destroyer(size_t element_size, void (*destroyer)(void*)) {
   stack stk;
-  stk.data = vec_init_with_destroyer(0, element_size, destroyer);
+  stk.data = sbo_init_with_destroyer(element_size, destroyer);
+  return stk;
+}
+
+/**
+ * @brief Initializes a stack with a destroyer function and a custom allocator
+ * @param element_size Size of each element in the stack
+ * @param destroyer Function to destroy each element in the stack
+ * @param allocator Allocator used once the stack outgrows its embedded buffer, NULL for malloc
+ * @return stack
+*/
+stack stk_init_with_allocator(size_t element_size, void (*destroyer)(void*), dsa_allocator* allocator) {
+  stack stk;
+  stk.data = sbo_init_with_allocator(element_size, destroyer, allocator);
   return stk;
 }
 
@@ -27,7 +40,7 @@ stack stk_init_with_destroyer(size_t element_size, void (*destroyer)(void*)) {
 */
 stack stk_init(size_t element_size) {
   stack stk;
-  stk.data = vec_init(0, element_size);
+  stk.data = sbo_init(element_size);
   return stk;
 }
 
@@ -37,7 +50,7 @@ stack stk_init(size_t element_size) {
  * @return 1 if empty, 0 otherwise
 */
 int stk_empty(stack* stk) {
-  return vec_empty(&stk->data);
+  return sbo_empty(&stk->data);
 }
 
 
@@ -47,7 +60,7 @@ int stk_empty(stack* stk) {
  * @return size of the stack
 */
 size_t stk_size(stack* stk) {
-  return vec_size(&stk->data);
+  return sbo_size(&stk->data);
 }
 
 /**
@@ -56,7 +69,7 @@ size_t stk_size(stack* stk) {
  * @return pointer to the top element of the stack
 */
 void* stk_top(stack* stk) {
-  return vec_back(&stk->data);
+  return sbo_back(&stk->data);
 }
 
 /**
@@ -66,7 +79,7 @@ void* stk_top(stack* stk) {
  *
 */
 void stk_push(stack* stk, void* data) {
-  vec_push_back(&stk->data, data);
+  sbo_push_back(&stk->data, data);
 }
 
 /**
@@ -74,5 +87,13 @@ void stk_push(stack* stk, void* data) {
  * @param stk Stack to pop from
 */
 void stk_pop(stack* stk) {
-  vec_pop_back(&stk->data);
+  sbo_pop_back(&stk->data);
+}
+
+/**
+ * @brief Free the memory used by the stack
+ * @param stk Stack to free
+*/
+void stk_free(stack* stk) {
+  sbo_free(&stk->data);
 }
@@ -1,12 +1,14 @@
 #ifndef c_dsa_generic_stack_h
 #define c_dsa_generic_stack_h
 
-#include "../Vector/vector.h"
+#include "../SBO Vector/sbo_vector.h"
 
+// Small stacks keep their elements inside the struct and never allocate.
 typedef struct stack {
-  vector data;
+  sbo_vector data;
 } stack;
 
+stack stk_init_with_allocator(size_t element_size, void (*destroyer)(void*), dsa_allocator* allocator);
 stack stk_init_with_destroyer(size_t element_size, void (*destroyer)(void*));
 stack stk_init(size_t element_size);
 int stk_empty(stack* stk);
@@ -14,5 +16,6 @@ size_t stk_size(stack* stk);
 void* stk_top(stack* stk);
 void stk_push(stack* stk, void* data);
 void stk_pop(stack* stk);
+void stk_free(stack* stk);
 
 #endif
@@ -0,0 +1,478 @@
+/**
+ * Library for an unrolled linked list of element blocks.
+ * Author : Abinash Karmakar
+ * 2023-09-01 MIT License Version: 1.0
+ */
+
+#ifndef c_dsa_generic_unrolled_list_c
+#define c_dsa_generic_unrolled_list_c
+
+#include "unrolled_list.h"
+
+#include "../../Algorithms/algorithms.c"  // TODO: Remove this
+#include "../../Algorithms/algorithms.h"
+#include "assert.h"
+#include "string.h"
+
+/**
+ * @brief Factory function for creating an unrolled list with a custom block size and allocator.
+ * @param element_size The size of each element in the list.
+ * @param block_capacity The number of elements per block, 0 to fit a block in UL_BLOCK_BYTES.
+ * @param destroyer The function that will be called when elements are removed from the list.
+ * @param allocator The allocator used for the blocks, NULL for malloc.
+ * @return An empty unrolled list, no block is allocated yet.
+ * Time complexity: O(1)
+ */
+unrolled_list ul_init_with_allocator(size_t element_size, size_t block_capacity, void (*destroyer)(void*), dsa_allocator* allocator) {
+   unrolled_list list;
+   list.size = 0;
+   list.element_size = element_size;
+   if (block_capacity == 0) block_capacity = (UL_BLOCK_BYTES - sizeof(ul_block)) / element_size;
+   list.block_capacity = block_capacity < UL_MIN_BLOCK_CAPACITY ? UL_MIN_BLOCK_CAPACITY : block_capacity;
+   list.block_count = 0;
+   list.head = NULL;
+   list.tail = NULL;
+   list.destroyer = destroyer;
+   list.allocator = allocator ? *allocator : dsa_default_allocator();
+   return list;
+}
+
+/**
+ * @brief Factory function for creating an unrolled list.
+ * @param element_size The size of each element in the list.
+ * @param destroyer The function that will be called when elements are removed from the list.
+ * @return An empty unrolled list with blocks of about UL_BLOCK_BYTES bytes.
+ * Time complexity: O(1)
+ */
+unrolled_list ul_init_with_destroyer(size_t element_size, void (*destroyer)(void*)) {
+   return ul_init_with_allocator(element_size, 0, destroyer, NULL);
+}
+
+/**
+ * @brief Factory function for creating an unrolled list.
+ * @param element_size The size of each element in the list.
+ * @return An empty unrolled list with blocks of about UL_BLOCK_BYTES bytes.
+ * Time complexity: O(1)
+ * @note The destroyer is set to NULL.
+ */
+unrolled_list ul_init(size_t element_size) {
+   return ul_init_with_destroyer(element_size, NULL);
+}
+
+/**
+ * @brief Function to get the number of elements in the list.
+ * @param list The unrolled list.
+ * @return The number of elements.
+ * Time complexity: O(1)
+ */
+size_t ul_size(unrolled_list* list) {
+   return list->size;
+}
+
+/**
+ * @brief Function to check if the list is empty.
+ * @param list The unrolled list.
+ * @return 1 if the list is empty, 0 otherwise.
+ * Time complexity: O(1)
+ */
+int ul_empty(unrolled_list* list) {
+   return list->size == 0;
+}
+
+/**
+ * @brief Function to get the number of blocks in the list.
+ * @param list The unrolled list.
+ * @return The number of blocks.
+ * Time complexity: O(1)
+ */
+size_t ul_block_count(unrolled_list* list) {
+   return list->block_count;
+}
+
+/**
+ * @brief Function to get the number of bytes allocated for each block.
+ * @param list The unrolled list.
+ * @return The size of a block, header included.
+ * Time complexity: O(1)
+ * @note This function is used internally by the library.
+ */
+size_t __ul_block_bytes(unrolled_list* list) {
+   return sizeof(ul_block) + list->block_capacity * list->element_size;
+}
+
+/**
+ * @brief Function to get the address of a slot of a block.
+ * @param list The unrolled list.
+ * @param block The block.
+ * @param offset The position in the block.
+ * @return Pointer to the slot.
+ * Time complexity: O(1)
+ * @note This function is used internally by the library.
+ */
+void* __ul_slot(unrolled_list* list, ul_block* block, size_t offset) {
+   return (void*)block->data + offset * list->element_size;
+}
+
+/**
+ * @brief Function to link a new empty block after a block.
+ * @param list The unrolled list.
+ * @param block The block to link after, NULL to link the new block first.
+ * @return The new block.
+ * Time complexity: O(1)
+ * @note This function is used internally by the library.
+ */
+ul_block* __ul_new_block_after(unrolled_list* list, ul_block* block) {
+   ul_block* new_block = (ul_block*)dsa_alloc(&list->allocator, __ul_block_bytes(list));
+   assert(new_block && "Not Enough Memory!");
+   new_block->count = 0;
+   new_block->prev = block;
+   new_block->next = block ? block->next : list->head;
+   if (new_block->next) new_block->next->prev = new_block;
+   else list->tail = new_block;
+   if (block) block->next = new_block;
+   else list->head = new_block;
+   list->block_count++;
+   return new_block;
+}
+
+/**
+ * @brief Function to unlink and free a block, its elements must have been moved or destroyed.
+ * @param list The unrolled list.
+ * @param block The block.
+ * Time complexity: O(1)
+ * @note This function is used internally by the library.
+ */
+void __ul_free_block(unrolled_list* list, ul_block* block) {
+   if (block->prev) block->prev->next = block->next;
+   else list->head = block->next;
+   if (block->next) block->next->prev = block->prev;
+   else list->tail = block->prev;
+   dsa_free(&list->allocator, block, __ul_block_bytes(list));
+   list->block_count--;
+}
+
+/**
+ * @brief Function to find the block holding an element.
+ * @param list The unrolled list.
+ * @param index The index of the element, less than the size of the list.
+ * @param offset Set to the position of the element in the block.
+ * @return The block.
+ * Time complexity: O(n / B) where B is the block capacity
+ * @note This function is used internally by the library.
+ * @note The walk starts from whichever end of the list is closer.
+ */
+ul_block* __ul_locate(unrolled_list* list, size_t index, size_t* offset) {
+   ul_block* block;
+   if (index < list->size / 2) {
+      block = list->head;
+      while (index >= block->count) {
+         index -= block->count;
+         block = block->next;
+      }
+   } else {
+      size_t from_end = list->size - index;  // At least 1
+      block = list->tail;
+      while (from_end > block->count) {
+         from_end -= block->count;
+         block = block->prev;
+      }
+      index = block->count - from_end;
+   }
+   *offset = index;
+   return block;
+}
+
+/**
+ * @brief Function to move the upper half of a block to a new block after it.
+ * @param list The unrolled list.
+ * @param block The block.
+ * Time complexity: O(B)
+ * @note This function is used internally by the library.
+ */
+void __ul_split(unrolled_list* list, ul_block* block) {
+   ul_block* upper = __ul_new_block_after(list, block);
+   size_t keep = block->count / 2;
+   upper->count = block->count - keep;
+   memcpy(upper->data, __ul_slot(list, block, keep), upper->count * list->element_size);
+   block->count = keep;
+}
+
+/**
+ * @brief Function to free an empty block or merge a block under half full with a neighbour.
+ * @param list The unrolled list.
+ * @param block The block an element was just removed from.
+ * Time complexity: O(B)
+ * @note This function is used internally by the library.
+ */
+void __ul_rebalance(unrolled_list* list, ul_block* block) {
+   if (block->count == 0) {
+      __ul_free_block(list, block);
+      return;
+   }
+   if (block->count >= list->block_capacity / 2) return;
+   // Merge the block into the previous one, or the next block into this one
+   ul_block* into = block->prev;
+   ul_block* from = block;
+   if (into == NULL || into->count + from->count > list->block_capacity) {
+      into = block;
+      from = block->next;
+   }
+   if (from == NULL || into->count + from->count > list->block_capacity) return;
+   memcpy(__ul_slot(list, into, into->count), from->data, from->count * list->element_size);
+   into->count += from->count;
+   __ul_free_block(list, from);
+}
+
+/**
+ * @brief Function to get an element of the list.
+ * @param list The unrolled list.
+ * @param index The index of the element.
+ * @return Pointer to the element.
+ * Time complexity: O(n / B) where B is the block capacity
+ */
+void* ul_at(unrolled_list* list, size_t index) {
+   assert(index < list->size && "Index out of bounds");
+   size_t offset;
+   ul_block* block = __ul_locate(list, index, &offset);
+   return __ul_slot(list, block, offset);
+}
+
+/**
+ * @brief Function to get the first element of the list.
+ * @param list The unrolled list.
+ * @return Pointer to the first element.
+ * Time complexity: O(1)
+ */
+void* ul_front(unrolled_list* list) {
+   assert(list->size > 0 && "List is empty");
+   return list->head->data;
+}
+
+/**
+ * @brief Function to get the last element of the list.
+ * @param list The unrolled list.
+ * @return Pointer to the last element.
+ * Time complexity: O(1)
+ */
+void* ul_back(unrolled_list* list) {
+   assert(list->size > 0 && "List is empty");
+   return __ul_slot(list, list->tail, list->tail->count - 1);
+}
+
+/**
+ * @brief Function to overwrite an element of the list.
+ * @param list The unrolled list.
+ * @param index The index of the element.
+ * @param data Pointer to the new value, it is copied.
+ * Time complexity: O(n / B) where B is the block capacity
+ */
+void ul_set_at(unrolled_list* list, size_t index, void* data) {
+   memcpy(ul_at(list, index), data, list->element_size);
+}
+
+/**
+ * @brief Function to add an element at the end of the list.
+ * @param list The unrolled list.
+ * @param data Pointer to the element, it is copied.
+ * Time complexity: O(1)
+ */
+void ul_push_back(unrolled_list* list, void* data) {
+   ul_block* block = list->tail;
+   if (block == NULL || block->count == list->block_capacity)
+      block = __ul_new_block_after(list, list->tail);
+   memcpy(__ul_slot(list, block, block->count++), data, list->element_size);
+   list->size++;
+}
+
+/**
+ * @brief Function to add an element at the start of the list.
+ * @param list The unrolled list.
+ * @param data Pointer to the element, it is copied.
+ * Time complexity: O(B) where B is the block capacity
+ */
+void ul_push_front(unrolled_list* list, void* data) {
+   ul_block* block = list->head;
+   if (block == NULL || block->count == list->block_capacity)
+      block = __ul_new_block_after(list, NULL);
+   memmove(__ul_slot(list, block, 1), block->data, block->count * list->element_size);
+   memcpy(block->data, data, list->element_size);
+   block->count++;
+   list->size++;
+}
+
+/**
+ * @brief Function to remove the last element of the list.
+ * @param list The unrolled list.
+ * Time complexity: O(1)
+ */
+void ul_pop_back(unrolled_list* list) {
+   assert(list->size > 0 && "Cannot Delete, Empty List!");
+   ul_block* block = list->tail;
+   void* back = __ul_slot(list, block, block->count - 1);
+   if (list->destroyer) list->destroyer(back);
+   if (--block->count == 0) __ul_free_block(list, block);
+   list->size--;
+}
+
+/**
+ * @brief Function to remove the first element of the list.
+ * @param list The unrolled list.
+ * Time complexity: O(B) where B is the block capacity
+ */
+void ul_pop_front(unrolled_list* list) {
+   assert(list->size > 0 && "Cannot Delete, Empty List!");
+   ul_block* block = list->head;
+   if (list->destroyer) list->destroyer(block->data);
+   block->count--;
+   memmove(block->data, __ul_slot(list, block, 1), block->count * list->element_size);
+   if (block->count == 0) __ul_free_block(list, block);
+   list->size--;
+}
+
+/**
+ * @brief Function to insert an element before a position.
+ * @param list The unrolled list.
+ * @param index The index of the new element, at most the size of the list.
+ * @param data Pointer to the element, it is copied.
+ * Time complexity: O(n / B + B) where B is the block capacity
+ * @note A full block is split in two halves before inserting.
+ */
+void ul_insert_at(unrolled_list* list, size_t index, void* data) {
+   assert(index <= list->size && "Index out of bounds");
+   if (index == list->size) {
+      ul_push_back(list, data);
+      return;
+   }
+   size_t offset;
+   ul_block* block = __ul_locate(list, index, &offset);
+   if (block->count == list->block_capacity) {
+      __ul_split(list, block);
+      if (offset > block->count) {
+         offset -= block->count;
+         block = block->next;
+      }
+   }
+   void* slot = __ul_slot(list, block, offset);
+   memmove(slot + list->element_size, slot, (block->count - offset) * list->element_size);
+   memcpy(slot, data, list->element_size);
+   block->count++;
+   list->size++;
+}
+
+/**
+ * @brief Function to remove an element.
+ * @param list The unrolled list.
+ * @param index The index of the element.
+ * Time complexity: O(n / B + B) where B is the block capacity
+ * @note A block that falls under half full is merged with a neighbour when they fit in one block.
+ */
+void ul_erase_at(unrolled_list* list, size_t index) {
+   assert(index < list->size && "Index out of bounds");
+   size_t offset;
+   ul_block* block = __ul_locate(list, index, &offset);
+   void* slot = __ul_slot(list, block, offset);
+   if (list->destroyer) list->destroyer(slot);
+   block->count--;
+   memmove(slot, slot + list->element_size, (block->count - offset) * list->element_size);
+   list->size--;
+   __ul_rebalance(list, block);
+}
+
+/**
+ * @brief Function to call a callback on every block.
+ * @param list The unrolled list.
+ * @param callback The callback, called with a pointer to the first element of the block
+ * and the number of elements in it.
+ * Time complexity: O(n / B) callbacks where B is the block capacity
+ * @note The elements of a block are contiguous, so the callback can run any range kernel on them.
+ */
+void ul_for_each_block(unrolled_list* list, void (*callback)(void*, size_t)) {
+   for (ul_block* block = list->head; block; block = block->next)
+      callback(block->data, block->count);
+}
+
+/**
+ * @brief Function to call a callback on every element with its index.
+ * @param list The unrolled list.
+ * @param callback The callback, called with a pointer to the element and its index.
+ * Time complexity: O(n)
+ */
+void ul_for_each_idx(unrolled_list* list, void (*callback)(void*, size_t)) {
+   size_t index = 0;
+   for (ul_block* block = list->head; block; block = block->next)
+      for (size_t i = 0; i < block->count; i++, index++)
+         callback(__ul_slot(list, block, i), index);
+}
+
+/**
+ * @brief Function to call a callback on every element.
+ * @param list The unrolled list.
+ * @param callback The callback, called with a pointer to the element.
+ * Time complexity: O(n)
+ */
+void ul_for_each(unrolled_list* list, void (*callback)(void*)) {
+   for (ul_block* block = list->head; block; block = block->next)
+      for_each_n(block->data, block->count, list->element_size, callback);
+}
+
+/**
+ * @brief Function to find the first occurrence of a value.
+ * @param list The unrolled list.
+ * @param data Pointer to the value, compared with memcmp.
+ * @return The index of the element, or ul_size() if not found.
+ * Time complexity: O(n)
+ */
+size_t ul_find(unrolled_list* list, void* data) {
+   size_t index = 0;
+   for (ul_block* block = list->head; block; block = block->next) {
+      void* start = block->data;
+      void* end = start + block->count * list->element_size;
+      void* found = find(start, end, list->element_size, data);
+      if (found != end) return index + (found - start) / list->element_size;
+      index += block->count;
+   }
+   return list->size;
+}
+
+/**
+ * @brief Function to find the first element matching a predicate.
+ * @param list The unrolled list.
+ * @param predicate The predicate, returns non zero for a match.
+ * @return The index of the element, or ul_size() if not found.
+ * Time complexity: O(n)
+ */
+size_t ul_find_if(unrolled_list* list, int (*predicate)(void*)) {
+   size_t index = 0;
+   for (ul_block* block = list->head; block; block = block->next) {
+      void* start = block->data;
+      void* end = start + block->count * list->element_size;
+      void* found = find_if(start, end, list->element_size, predicate);
+      if (found != end) return index + (found - start) / list->element_size;
+      index += block->count;
+   }
+   return list->size;
+}
+
+/**
+ * @brief Function to remove every element and free every block.
+ * @param list The unrolled list.
+ * Time complexity: O(n) with a destroyer, O(n / B) otherwise
+ */
+void ul_clear(unrolled_list* list) {
+   if (list->destroyer) ul_for_each(list, list->destroyer);
+   while (list->head) __ul_free_block(list, list->head);
+   list->size = 0;
+}
+
+/**
+ * @brief Function to destroy the unrolled list fully.
+ * @param list The unrolled list.
+ * Time complexity: O(n) with a destroyer, O(n / B) otherwise
+ */
+void ul_free(unrolled_list* list) {
+   ul_clear(list);
+}
+
+#endif // c_dsa_generic_unrolled_list_c
+
+// End of 'Data Structures/Unrolled List/unrolled_list.c'
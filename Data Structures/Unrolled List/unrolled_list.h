@@ -0,0 +1,87 @@
+#ifndef c_dsa_generic_unrolled_list_h
+#define c_dsa_generic_unrolled_list_h
+
+#include "stddef.h"
+#include "../../Memory/allocator.h"
+
+// Target size in bytes of a block, header included. A few cache lines keeps scans close to an array.
+#ifndef UL_BLOCK_BYTES
+#define UL_BLOCK_BYTES 256
+#endif
+
+// Smallest number of elements in a block, whatever the element size.
+#define UL_MIN_BLOCK_CAPACITY 4
+
+/**
+ * @brief A block of consecutive elements of an unrolled list.
+ * @var ul_block* prev The previous block, NULL for the first one.
+ * @var ul_block* next The next block, NULL for the last one.
+ * @var size_t count The number of elements in the block.
+ * @var max_align_t data The elements, packed from the start of the block.
+*/
+typedef struct ul_block {
+   struct ul_block* prev;
+   struct ul_block* next;
+   size_t count;
+   max_align_t data[];
+} ul_block;
+
+/**
+ * @brief A generic list of blocks, each holding up to `block_capacity` elements.
+ * @var size_t size The number of elements in the list.
+ * @var size_t element_size The size of each element in the list.
+ * @var size_t block_capacity The number of elements a block can hold.
+ * @var size_t block_count The number of blocks in the list.
+ * @var ul_block* head The first block.
+ * @var ul_block* tail The last block.
+ * @var void (*destroyer)(void*) A function pointer to a function that destroys the data
+ * allocated by the user in the list. It is called when an element is removed using library functions.
+ * @var dsa_allocator allocator The allocator used for the blocks.
+ * @note Inserting into a full block splits it in two halves, erasing from a block that falls
+ * under half full merges it with a neighbour when they fit in one block.
+*/
+typedef struct unrolled_list {
+   size_t size;
+   size_t element_size;
+   size_t block_capacity;
+   size_t block_count;
+   ul_block* head;
+   ul_block* tail;
+   void (*destroyer)(void*);
+   dsa_allocator allocator;
+} unrolled_list;
+
+
+unrolled_list ul_init_with_allocator(size_t element_size, size_t block_capacity, void (*destroyer)(void*), dsa_allocator* allocator);
+unrolled_list ul_init_with_destroyer(size_t element_size, void (*destroyer)(void*));
+unrolled_list ul_init(size_t element_size);
+size_t ul_size(unrolled_list* list);
+int ul_empty(unrolled_list* list);
+size_t ul_block_count(unrolled_list* list);
+size_t __ul_block_bytes(unrolled_list* list);
+void* __ul_slot(unrolled_list* list, ul_block* block, size_t offset);
+ul_block* __ul_new_block_after(unrolled_list* list, ul_block* block);
+void __ul_free_block(unrolled_list* list, ul_block* block);
+ul_block* __ul_locate(unrolled_list* list, size_t index, size_t* offset);
+void __ul_split(unrolled_list* list, ul_block* block);
+void __ul_rebalance(unrolled_list* list, ul_block* block);
+void* ul_at(unrolled_list* list, size_t index);
+void* ul_front(unrolled_list* list);
+void* ul_back(unrolled_list* list);
+void ul_set_at(unrolled_list* list, size_t index, void* data);
+void ul_push_back(unrolled_list* list, void* data);
+void ul_push_front(unrolled_list* list, void* data);
+void ul_pop_back(unrolled_list* list);
+void ul_pop_front(unrolled_list* list);
+void ul_insert_at(unrolled_list* list, size_t index, void* data);
+void ul_erase_at(unrolled_list* list, size_t index);
+void ul_for_each_block(unrolled_list* list, void (*callback)(void*, size_t));
+void ul_for_each_idx(unrolled_list* list, void (*callback)(void*, size_t));
+void ul_for_each(unrolled_list* list, void (*callback)(void*));
+size_t ul_find(unrolled_list* list, void* data);
+size_t ul_find_if(unrolled_list* list, int (*predicate)(void*));
+void ul_clear(unrolled_list* list);
+void ul_free(unrolled_list* list);
+
+
+#endif // c_dsa_generic_unrolled_list_h
@@ -4,6 +4,9 @@
  * 2023-09-01 MIT License Version: 1.0
  */
 
+#ifndef c_dsa_generic_vector_c
+#define c_dsa_generic_vector_c
+
 #include "vector.h"
 
 #include "../../Algorithms/algorithms.c"  // TODO: Remove this
@@ -11,31 +14,70 @@
 #include "assert.h"
 #include "malloc.h"
 
-/**
- * @brief Factory function for creating a vector.
+#if defined(__linux__)
+#include "sys/mman.h"
+#include "unistd.h"
+#endif
+
+// mmap backed storage needs the Linux mapping API, otherwise vectors always stay on the heap.
+#if defined(__linux__) && defined(MAP_ANONYMOUS)
+#define VEC_HAS_MMAP 1
+#ifndef MREMAP_MAYMOVE
+// mremap is only declared with _GNU_SOURCE, which may not be defined before the first include.
+#define MREMAP_MAYMOVE 1
+extern void* mremap(void* old_address, size_t old_size, size_t new_size, int flags, ...);
+#endif
+#else
+#define VEC_HAS_MMAP 0
+#endif
+
+/**
+ * @brief Factory function for creating a vector using a custom allocator.
  * @param size The initial size of the vector.
  * @param element_size The size of each element in the vector.
  * @param destroyer The function that will be called when elements are removed from the vector.
- * @return A vector with the given size, element size and destroyer.
- * @warning It is the responsibility of the user to if the vector allocates memory, to free the memory.
+ * @param allocator The allocator used for every allocation of the vector, NULL for malloc.
+ * It is copied into the vector.
+ * @return A vector with the given size, element size, destroyer and allocator.
+ * @note With a custom allocator the vector never switches to mmap backed storage on its own.
  * Time complexity: O(1)
  */
-
-vector vec_init_with_destroyer(size_t size, size_t element_size, void (*destroyer)(void*)) {
+vector vec_init_with_allocator(size_t size, size_t element_size, void (*destroyer)(void*), dsa_allocator* allocator) {
    assert(size >= 0 && "Size must be non negative");
    assert(element_size > 0 && "Element size must be positive");
    vector vec;    // Creating a vector.
    vec.size = 0;  // Setting the size to 0
    vec.element_size = element_size;
    vec.capacity = size;
+   vec.allocator = allocator ? *allocator : dsa_default_allocator();
    if (size > 0)
-      vec.data = malloc(size * element_size);
+      vec.data = dsa_alloc(&vec.allocator, size * element_size);
    else
       vec.data = NULL;
    vec.destroyer = destroyer;
+   vec.growth = vec_growth_default();
+   if (allocator) vec.growth.mmap_threshold = 0;
+   vec.stats.reallocs = 0;
+   vec.stats.bytes_copied = 0;
+   vec.storage = VEC_STORAGE_HEAP;
+   vec.alignment = 0;
+   vec.type = NULL;
    return vec;
 }
 
+/**
+ * @brief Factory function for creating a vector.
+ * @param size The initial size of the vector.
+ * @param element_size The size of each element in the vector.
+ * @param destroyer The function that will be called when elements are removed from the vector.
+ * @return A vector with the given size, element size and destroyer.
+ * @warning It is the responsibility of the user to if the vector allocates memory, to free the memory.
+ * Time complexity: O(1)
+ */
+vector vec_init_with_destroyer(size_t size, size_t element_size, void (*destroyer)(void*)) {
+   return vec_init_with_allocator(size, element_size, destroyer, NULL);
+}
+
 /**
  * @brief Factory function for creating a vector.
  * @param size The initial size of the vector.
@@ -48,6 +90,60 @@ vector vec_init(size_t size, size_t element_size) {
    return vec_init_with_destroyer(size, element_size, NULL);
 }
 
+/**
+ * @brief Factory function for creating a vector with aligned storage.
+ * @param size The initial capacity of the vector.
+ * @param element_size The size of each element in the vector.
+ * @param alignment The alignment of the data, a power of two (e.g. 64 for cache lines and AVX-512).
+ * @return An empty vector whose data stays aligned across every reallocation.
+ * Time complexity: O(1)
+ * @note The allocation is padded to a multiple of `alignment`, so SIMD kernels can process
+ * the range [vec_begin, vec_padded_end) in full vector widths without a scalar epilogue.
+ */
+vector vec_init_aligned(size_t size, size_t element_size, size_t alignment) {
+   assert(alignment > 0 && (alignment & (alignment - 1)) == 0 && "Alignment must be a power of two");
+   vector vec = vec_init(0, element_size);
+   vec.alignment = alignment;
+   if (size > 0) __force_reserve_to(&vec, size);
+   return vec;
+}
+
+/**
+ * @brief Factory function for creating a vector of a described type.
+ * @param size The initial capacity of the vector.
+ * @param type The descriptor of the elements, it must outlive the vector.
+ * @return An empty vector using the size, alignment and destroy function of the type.
+ * Time complexity: O(1)
+ * @note vec_sort, vec_find, vec_hash and vec_serialize pick their kernel from the type.
+ */
+vector vec_init_typed(size_t size, const dsa_type* type) {
+   vector vec = vec_init_with_destroyer(0, type->size, type->destroy);
+   vec.type = type;
+   if (type->alignment > DSA_DEFAULT_ALIGNMENT) vec.alignment = type->alignment;
+   if (size > 0) __force_reserve_to(&vec, size);
+   return vec;
+}
+
+/**
+ * @brief Factory function for creating a vector backed by an anonymous mapping.
+ * @param size The initial capacity of the vector.
+ * @param element_size The size of each element in the vector.
+ * @param huge_pages Whether to back the vector with huge pages.
+ * @return An empty vector, growing with mremap instead of realloc.
+ * Time complexity: O(1)
+ * @note Meant for very large vectors. Without mmap support, a normal vector is returned.
+ * @note Vectors switch to this storage on their own above VEC_MMAP_THRESHOLD bytes.
+ */
+vector vec_init_mmap(size_t size, size_t element_size, vec_huge_pages huge_pages) {
+   vector vec = vec_init(0, element_size);
+   vec.growth.huge_pages = huge_pages;
+#if VEC_HAS_MMAP
+   vec.storage = VEC_STORAGE_MMAP;
+#endif
+   if (size > 0) __force_reserve_to(&vec, size);
+   return vec;
+}
+
 /**
  * @brief Function to get the capacity of the vector.
  * @param vec The vector.
@@ -120,6 +216,17 @@ void* vec_end(vector* vec) {
    return vec->data + vec->size * vec->element_size;
 }
 
+/**
+ * @brief Function to get void pointer to the end of the elements, rounded up to the alignment of the vector.
+ * @param vec The vector.
+ * @return A void pointer past the padding after the last element.
+ * Time complexity: O(1)
+ * @note The bytes in [vec_end, vec_padded_end) are allocated but hold no element.
+ */
+void* vec_padded_end(vector* vec) {
+   return vec->data + dsa_align_up(vec->size * vec->element_size, vec->alignment);
+}
+
 /**
  * @brief Function to get void pointer to the first element of the vector.
  * @param vec The vector.
@@ -150,7 +257,7 @@ void* vec_back(vector* vec) {
  * Time complexity: O(1)
  * @note This function is used internally by the library.
  */
-void __check_range(vector* vec, void* start, void* end) {
+void __vec_check_range(vector* vec, void* start, void* end) {
    assert(start >= vec->data && "Start pointer out of bounds");
    assert(end <= vec->data + vec->size * vec->element_size && "End pointer out of bounds");
    assert(start <= end && "Start pointer must be less than or equal to end pointer");
@@ -188,7 +295,7 @@ void vec_for_each(vector* vec, void (*callback)(void*)) {
  * Time complexity: O(n)
  */
 void vec_for_each_n_idx(vector* vec, void* start, size_t n, void (*callback)(void*, size_t)) {
-   __check_range(vec, start, start + n * vec->element_size);
+   __vec_check_range(vec, start, start + n * vec->element_size);
    for_each_n_idx(start, n, vec->element_size, callback);
 }
 
@@ -213,7 +320,7 @@ void vec_for_each_n(vector* vec, void* start, size_t n, void (*callback)(void*))
  * Time complexity: O(n)
  */
 void vec_for_each_rng_idx(vector* vec, void* start, void* end, void (*callback)(void*, size_t)) {
-   __check_range(vec, start, end);
+   __vec_check_range(vec, start, end);
    for_each_rng_idx(start, end, vec->element_size, callback);
 }
 
@@ -306,7 +413,7 @@ void vec_map_rng(vector* vec, void* start, void* end, void (*callback)(void*)) {
  * Time complexity: O(n)
  */
 void* vec_find(vector* vec, void* data) {
-   return find(vec->data, vec->data + vec->size * vec->element_size, vec->element_size, data);
+   return vec_find_rng(vec, vec->data, vec->data + vec->size * vec->element_size, data);
 }
 
 /**
@@ -318,9 +425,11 @@ void* vec_find(vector* vec, void* data) {
  * @return A void pointer to the first occurrence of the value in the range [start, end) in the vector.
  *         If not found returns a pointer to the end of the vector.
  * Time complexity: O(n)
+ * @note With a type descriptor, values are compared by typed_find(), otherwise bytewise.
  */
 void* vec_find_rng(vector* vec, void* start, void* end, void* data) {
-   __check_range(vec, start, end);
+   __vec_check_range(vec, start, end);
+   if (vec->type) return typed_find(start, end, vec->type, data);
    return find_rng(start, end, vec->element_size, data);
 }
 
@@ -335,8 +444,7 @@ void* vec_find_rng(vector* vec, void* start, void* end, void* data) {
  * Time complexity: O(n)
  */
 void* vec_find_n(vector* vec, void* start, size_t n, void* data) {
-   __check_range(vec, start, start + n * vec->element_size);
-   return find_n(start, n, vec->element_size, data);
+   return vec_find_rng(vec, start, start + n * vec->element_size, data);
 }
 
 /**
@@ -362,7 +470,7 @@ void* vec_find_if(vector* vec, int (*predicate)(void*)) {
  * Time complexity: O(n)
  */
 void* vec_find_if_rng(vector* vec, void* start, void* end, int (*predicate)(void*)) {
-   __check_range(vec, start, end);
+   __vec_check_range(vec, start, end);
    return find_if_rng(start, end, vec->element_size, predicate);
 }
 
@@ -377,7 +485,7 @@ void* vec_find_if_rng(vector* vec, void* start, void* end, int (*predicate)(void
  * Time complexity: O(n)
  */
 void* vec_find_if_n(vector* vec, void* start, size_t n, int (*predicate)(void*)) {
-   __check_range(vec, start, start + n * vec->element_size);
+   __vec_check_range(vec, start, start + n * vec->element_size);
    return find_if_n(start, n, vec->element_size, predicate);
 }
 
@@ -404,7 +512,7 @@ void* vec_find_if_not(vector* vec, int (*predicate)(void*)) {
  * Time complexity: O(n)
  */
 void* vec_find_if_not_rng(vector* vec, void* start, void* end, int (*predicate)(void*)) {
-   __check_range(vec, start, end);
+   __vec_check_range(vec, start, end);
    return find_if_not_rng(start, end, vec->element_size, predicate);
 }
 
@@ -419,7 +527,7 @@ void* vec_find_if_not_rng(vector* vec, void* start, void* end, int (*predicate)(
  * Time complexity: O(n)
  */
 void* vec_find_if_not_n(vector* vec, void* start, size_t n, int (*predicate)(void*)) {
-   __check_range(vec, start, start + n * vec->element_size);
+   __vec_check_range(vec, start, start + n * vec->element_size);
    return find_if_not_n(start, n, vec->element_size, predicate);
 }
 
@@ -442,7 +550,7 @@ void vec_reverse(vector* vec) {
  * Time complexity: O(n)
  */
 void vec_reverse_n(vector* vec, void* start, size_t n) {
-   __check_range(vec, start, start + n * vec->element_size);
+   __vec_check_range(vec, start, start + n * vec->element_size);
    reverse(start, start + n * vec->element_size, vec->element_size);
 }
 
@@ -454,7 +562,7 @@ void vec_reverse_n(vector* vec, void* start, size_t n) {
  * Time complexity: O(n)
  */
 void vec_reverse_rng(vector* vec, void* start, void* end) {
-   __check_range(vec, start, end);
+   __vec_check_range(vec, start, end);
    reverse(start, end, vec->element_size);
 }
 
@@ -475,9 +583,10 @@ void vec_sort_cmp(vector* vec, int (*cmp)(void*, void*)) {
  * @brief Function to sort the vector
  * @param vec The vector.
  * Time complexity: O(n log n)
+ * @note With a type descriptor, the kernel is chosen by typed_sort(), otherwise elements are compared as int.
  */
 void vec_sort(vector* vec) {
-   vec_sort_cmp(vec, int_cmp);
+   vec_sort_rng(vec, vec->data, vec->data + vec->size * vec->element_size);
 }
 
 /**
@@ -489,7 +598,7 @@ void vec_sort(vector* vec) {
  * Time complexity: O(n log n)
  */
 void vec_sort_n_cmp(vector* vec, void* start, size_t n, int (*cmp)(void*, void*)) {
-   __check_range(vec, start, start + n * vec->element_size);
+   __vec_check_range(vec, start, start + n * vec->element_size);
    sort(start, start + n * vec->element_size, vec->element_size, cmp);
 }
 
@@ -501,7 +610,7 @@ void vec_sort_n_cmp(vector* vec, void* start, size_t n, int (*cmp)(void*, void*)
  * Time complexity: O(n log n)
  */
 void vec_sort_n(vector* vec, void* start, size_t n) {
-   vec_sort_n_cmp(vec, start, n, int_cmp);
+   vec_sort_rng(vec, start, start + n * vec->element_size);
 }
 
 /**
@@ -513,7 +622,7 @@ void vec_sort_n(vector* vec, void* start, size_t n) {
  * Time complexity: O(n log n)
  */
 void vec_sort_rng_cmp(vector* vec, void* start, void* end, int (*cmp)(void*, void*)) {
-   __check_range(vec, start, end);
+   __vec_check_range(vec, start, end);
    sort(start, end, vec->element_size, cmp);
 }
 
@@ -523,11 +632,40 @@ void vec_sort_rng_cmp(vector* vec, void* start, void* end, int (*cmp)(void*, voi
  * @param start The start pointer.
  * @param end The end pointer.
  * Time complexity: O(n log n)
+ * @note With a type descriptor, the kernel is chosen by typed_sort(), otherwise elements are compared as int.
  */
 void vec_sort_rng(vector* vec, void* start, void* end) {
+   if (vec->type) {
+      __vec_check_range(vec, start, end);
+      typed_sort(start, end, vec->type, &vec->allocator);
+      return;
+   }
    vec_sort_rng_cmp(vec, start, end, int_cmp);
 }
 
+/**
+ * @brief Function to hash the elements of the vector.
+ * @param vec The vector, with a type descriptor.
+ * @return The hash, depending on the order of the elements.
+ * Time complexity: O(n)
+ */
+size_t vec_hash(vector* vec) {
+   assert(vec->type && "Vector has no type descriptor");
+   return typed_hash_range(vec->data, vec->data + vec->size * vec->element_size, vec->type);
+}
+
+/**
+ * @brief Function to write the elements of the vector into a flat buffer.
+ * @param vec The vector, with a type descriptor.
+ * @param out The buffer, at least vec_size() * vec_element_size() bytes.
+ * @return The number of bytes written.
+ * Time complexity: O(n)
+ */
+size_t vec_serialize(vector* vec, void* out) {
+   assert(vec->type && "Vector has no type descriptor");
+   return typed_serialize(vec->data, vec->data + vec->size * vec->element_size, vec->type, out);
+}
+
 /**
  * @brief Function to fill the vector with a value in the range [start, end).
  * @param vec The vector.
@@ -537,7 +675,7 @@ void vec_sort_rng(vector* vec, void* start, void* end) {
  * Time complexity: O(n)
  */
 void vec_fill_rng(vector* vec, void* start, void* end, void* data) {
-   __check_range(vec, start, end);
+   __vec_check_range(vec, start, end);
    fill(start, end, vec->element_size, data);
 }
 
@@ -562,7 +700,7 @@ void vec_fill(vector* vec, void* data) {
  * Time complexity: O(n)
  */
 void vec_fill_n(vector* vec, void* start, size_t n, void* data) {
-   __check_range(vec, start, start + n * vec->element_size);
+   __vec_check_range(vec, start, start + n * vec->element_size);
    vec_fill_rng(vec, start, start + n * vec->element_size, data);
 }
 
@@ -627,7 +765,10 @@ void __vec_destroy_each_item(vector* vec) {
  */
 void __vec_destroyer(vector* vec) {
    __vec_destroy_each_item(vec);
-   free(vec->data);
+   if (vec->storage == VEC_STORAGE_HEAP)
+      dsa_free_aligned(&vec->allocator, vec->data, __vec_alloc_bytes(vec, vec->capacity), vec->alignment);
+   else if (vec->storage != VEC_STORAGE_INLINE)
+      __vec_mmap_reserve(vec, 0);
    vec->data = NULL;
    vec->size = 0;
    vec->capacity = 0;
@@ -654,6 +795,7 @@ void vec_clear(vector* vec) {
    // Destroying each item in the vector, but not freeing the vector.
    __vec_destroy_each_item(vec);
    vec->size = 0;
+   __vec_release_pages(vec, 0);
 }
 
 /**
@@ -664,8 +806,202 @@ void vec_clear(vector* vec) {
  * @note This function is used internally by the library.
  */
 void __force_reserve_to(vector* vec, size_t size) {
-   vec->data = realloc(vec->data, size * vec->element_size);
+   if (size == vec->capacity) return;
+   if (vec->storage == VEC_STORAGE_INLINE) {
+      __vec_spill_to_heap(vec, size);
+      return;
+   }
+   if (vec->storage != VEC_STORAGE_HEAP || (vec->growth.mmap_threshold && size * vec->element_size >= vec->growth.mmap_threshold)) {
+      if (__vec_mmap_reserve(vec, size)) return;
+   }
+   size_t old_bytes = __vec_alloc_bytes(vec, vec->capacity);
+   if (size == 0) {
+      dsa_free_aligned(&vec->allocator, vec->data, old_bytes, vec->alignment);
+      vec->data = NULL;
+      vec->capacity = 0;
+      return;
+   }
+   void* old_data = vec->data;
+   size_t old_capacity = vec->capacity;
+   vec->data = dsa_realloc_aligned(&vec->allocator, vec->data, old_bytes, __vec_alloc_bytes(vec, size), vec->alignment);
+   assert(vec->data && "Not Enough Memory!");
+   vec->capacity = size;
+   // Counting the reallocation, and the bytes realloc had to copy if it could not grow in place.
+   if (old_data == NULL) return;
+   vec->stats.reallocs++;
+   if (vec->data != old_data)
+      vec->stats.bytes_copied += (old_capacity < size ? old_capacity : size) * vec->element_size;
+}
+
+/**
+ * @brief Function to get the number of bytes allocated for the given capacity.
+ * @param vec The vector.
+ * @param capacity The capacity.
+ * @return The size of the elements, padded to a multiple of the alignment of the vector.
+ * Time complexity: O(1)
+ * @note This function is used internally by the library.
+ */
+size_t __vec_alloc_bytes(vector* vec, size_t capacity) {
+   return dsa_align_up(capacity * vec->element_size, vec->alignment);
+}
+
+/**
+ * @brief Function to move the data of a vector with inline storage to the heap.
+ * @param vec The vector.
+ * @param size The capacity of the new heap buffer.
+ * Time complexity: O(n)
+ * @note Shrinking an inline vector is a no-op, the inline buffer is kept.
+ * @note This function is used internally by the library.
+ */
+void __vec_spill_to_heap(vector* vec, size_t size) {
+   if (size <= vec->capacity) return;
+   void* data = dsa_alloc_aligned(&vec->allocator, __vec_alloc_bytes(vec, size), vec->alignment);
+   assert(data && "Not Enough Memory!");
+   memcpy(data, vec->data, vec->size * vec->element_size);
+   vec->stats.reallocs++;
+   vec->stats.bytes_copied += vec->size * vec->element_size;
+   vec->data = data;
+   vec->capacity = size;
+   vec->storage = VEC_STORAGE_HEAP;
+}
+
+#if VEC_HAS_MMAP
+/**
+ * @brief Function to get the granularity of the mapping of a vector with the given storage.
+ * @param storage The storage of the vector.
+ * @return The page size of the mapping.
+ * @note This function is used internally by the library.
+ */
+size_t __vec_page_size(vec_storage storage) {
+   if (storage == VEC_STORAGE_MMAP_HUGE) return VEC_HUGE_PAGE_SIZE;
+   return sysconf(_SC_PAGESIZE);
+}
+
+/**
+ * @brief Function to create a new anonymous mapping for a vector.
+ * @param vec The vector. Its storage is set to the kind of mapping that was created.
+ * @param capacity The number of elements to map, updated to fill the last page.
+ * @return The mapping, or NULL if it failed.
+ * @note This function is used internally by the library.
+ */
+void* __vec_map(vector* vec, size_t* capacity) {
+   size_t element_size = vec->element_size;
+   void* data = MAP_FAILED;
+   size_t page, bytes;
+#ifdef MAP_HUGETLB
+   if (vec->growth.huge_pages == VEC_HUGE_PAGES_HUGETLB) {
+      page = VEC_HUGE_PAGE_SIZE;
+      bytes = (*capacity * element_size + page - 1) / page * page;
+      data = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+      if (data != MAP_FAILED) vec->storage = VEC_STORAGE_MMAP_HUGE;
+   }
+#endif
+   if (data == MAP_FAILED) {
+      // No explicit huge pages reserved by the system, falling back to normal pages.
+      page = sysconf(_SC_PAGESIZE);
+      bytes = (*capacity * element_size + page - 1) / page * page;
+      data = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (data == MAP_FAILED) return NULL;
+      vec->storage = VEC_STORAGE_MMAP;
+#ifdef MADV_HUGEPAGE
+      if (vec->growth.huge_pages != VEC_HUGE_PAGES_NONE) madvise(data, bytes, MADV_HUGEPAGE);
+#endif
+   }
+   *capacity = bytes / element_size;
+   return data;
+}
+#endif
+
+/**
+ * @brief Function to reserve the vector to the given size using an anonymous mapping.
+ * @param vec The vector.
+ * @param size The new capacity of the vector. 0 unmaps the data.
+ * @return 1 on success, 0 if mmap is not available and the caller should use the heap.
+ * Time complexity: O(1) for an existing mapping, O(n) when moving from the heap.
+ * @note Growing and shrinking use mremap, which moves page table entries instead of copying.
+ * @note This function is used internally by the library.
+ */
+int __vec_mmap_reserve(vector* vec, size_t size) {
+#if VEC_HAS_MMAP
+   size_t element_size = vec->element_size;
+   if (vec->storage == VEC_STORAGE_HEAP || vec->data == NULL) {
+      if (size == 0) return 1;
+      // Mapping for the first time, copying the data over if the vector was on the heap.
+      void* data = __vec_map(vec, &size);
+      if (data == NULL) {
+         vec->storage = VEC_STORAGE_HEAP;
+         return 0;
+      }
+      if (vec->data != NULL) {
+         memcpy(data, vec->data, vec->size * element_size);
+         dsa_free_aligned(&vec->allocator, vec->data, __vec_alloc_bytes(vec, vec->capacity), vec->alignment);
+         vec->stats.reallocs++;
+         vec->stats.bytes_copied += vec->size * element_size;
+      }
+      vec->data = data;
+      vec->capacity = size;
+      return 1;
+   }
+   size_t page = __vec_page_size(vec->storage);
+   size_t old_bytes = (vec->capacity * element_size + page - 1) / page * page;
+   if (size == 0) {
+      munmap(vec->data, old_bytes);
+      vec->data = NULL;
+      vec->capacity = 0;
+      return 1;
+   }
+   // Filling the last page, and making the byte count a function of the capacity alone.
+   size = (size * element_size + page - 1) / page * page / element_size;
+   size_t new_bytes = (size * element_size + page - 1) / page * page;
+   if (new_bytes != old_bytes) {
+      void* data = mremap(vec->data, old_bytes, new_bytes, MREMAP_MAYMOVE);
+      if (data == MAP_FAILED) {
+         // Some mappings (e.g. huge pages on old kernels) cannot be remapped, copying instead.
+         vec_storage storage = vec->storage;
+         size_t capacity = size;
+         data = __vec_map(vec, &capacity);
+         if (data == NULL) {
+            vec->storage = storage;
+            assert(0 && "Not Enough Memory!");
+         }
+         size_t copy = vec->size < size ? vec->size : size;
+         memcpy(data, vec->data, copy * element_size);
+         munmap(vec->data, old_bytes);
+         vec->stats.bytes_copied += copy * element_size;
+         size = capacity;
+      }
+#ifdef MADV_HUGEPAGE
+      else if (vec->storage == VEC_STORAGE_MMAP && vec->growth.huge_pages != VEC_HUGE_PAGES_NONE)
+         madvise(data, new_bytes, MADV_HUGEPAGE);
+#endif
+      vec->data = data;
+      vec->stats.reallocs++;
+   }
    vec->capacity = size;
+   return 1;
+#else
+   return 0;
+#endif
+}
+
+/**
+ * @brief Function to give the pages past the first `keep` bytes of the vector back to the system.
+ * @param vec The vector.
+ * @param keep The number of bytes still in use.
+ * Time complexity: O(1)
+ * @note Only mmap backed vectors release memory, the capacity is kept and the pages
+ * are faulted in again, zeroed, when used.
+ * @note This function is used internally by the library.
+ */
+void __vec_release_pages(vector* vec, size_t keep) {
+#if VEC_HAS_MMAP && defined(MADV_DONTNEED)
+   if (vec->storage != VEC_STORAGE_MMAP && vec->storage != VEC_STORAGE_MMAP_HUGE) return;
+   if (vec->data == NULL) return;
+   size_t page = __vec_page_size(vec->storage);
+   size_t start = (keep + page - 1) / page * page;
+   size_t end = (vec->capacity * vec->element_size + page - 1) / page * page;
+   if (start < end) madvise(vec->data + start, end - start, MADV_DONTNEED);
+#endif
 }
 
 /**
@@ -701,6 +1037,7 @@ void vec_resize(vector* vec, size_t size) {
       void* start = vec->data + size * vec->element_size;
       void* end = vec->data + vec->size * vec->element_size;
       __vec_destroy_rng(vec, start, end);
+      __vec_release_pages(vec, size * vec->element_size);
    }
    vec->size = size;
 }
@@ -744,6 +1081,7 @@ void vec_pop_back(vector* vec) {
       vec->destroyer(pos);
    }
    vec->size--;
+   __vec_shrink_if_sparse(vec);
 }
 
 /**
@@ -795,6 +1133,7 @@ void vec_erase_rng(vector* vec, void* start, void* end) {
    size_t size = vec->data + vec->size * vec->element_size - end;
    memmove(start, end, size);
    vec->size -= (end - start) / vec->element_size;
+   __vec_shrink_if_sparse(vec);
 }
 
 /**
@@ -815,6 +1154,7 @@ void vec_erase(vector* vec, void* pos) {
    size_t size = end - pos - vec->element_size;
    memmove(pos, pos + vec->element_size, size);
    vec->size--;
+   __vec_shrink_if_sparse(vec);
 }
 
 /**
@@ -823,36 +1163,11 @@ void vec_erase(vector* vec, void* pos) {
  * @param pos The position pointer.
  * @param data The data to insert.
  * Time complexity: O(n)
+ * @note If the vector is full, then it grows according to its growth policy.
+ * @warning The data must not point inside the vector itself.
  */
 void vec_insert(vector* vec, void* pos, void* data) {
-   // If the position is out of bound of [start, end) of the vector, then do nothing.
-   // Here end is the address of the last element of the allocated memory.
-   void* start = vec->data;
-   void* capacityEnd = vec->data + vec->capacity * vec->element_size;
-   void* end = vec->data + vec->size * vec->element_size;
-
-   assert(pos >= start && "Position pointer out of bounds, before start");
-   assert(pos <= capacityEnd && "Position pointer out of bounds, after end");
-
-   if (pos == end) {
-      vec_push_back(vec, data);
-      return;
-   }
-
-   if (pos > end) {
-      // Move the elements after the end to the right.
-      size_t size = pos - end;
-      // Copying the data to the position.
-      memcpy(pos, data, vec->element_size);
-      vec->size += (pos - end) / vec->element_size + 1;
-   } else {
-      // Move the elements after the end to the right.
-      size_t size = end - pos;
-      memmove(pos + vec->element_size, pos, size);
-      // Copying the data to the position.
-      memcpy(pos, data, vec->element_size);
-      vec->size++;
-   }
+   vec_insert_rng(vec, pos, data, data + vec->element_size);
 }
 
 /**
@@ -862,34 +1177,99 @@ void vec_insert(vector* vec, void* pos, void* data) {
  * @param start The start pointer.
  * @param end The end pointer.
  * Time complexity: O(n)
+ * @note If the vector is too small, then it grows once according to its growth policy.
+ * @note A position past the end but inside the capacity extends the vector up to the inserted range.
+ * @warning The range must not point inside the vector itself.
  */
 void vec_insert_rng(vector* vec, void* pos, void* start, void* end) {
    // If the position is out of bound of [start, end) of the vector, then do nothing.
    // Here end is the address of the last element of the allocated memory.
    void* capacityEnd = vec->data + vec->capacity * vec->element_size;
-   void* vecEnd = vec->data + vec->size * vec->element_size;
 
    assert(pos >= vec->data && "Position pointer out of bounds, before start");
    assert(pos <= capacityEnd && "Position pointer out of bounds, after end");
    // Check if the range is valid.
    assert(start <= end && "Start pointer must be less than or equal to end pointer");
    assert((end - start) % vec->element_size == 0 && "Invalid range");
-   assert(end - start <= capacityEnd - vecEnd && "Not enough space in vector");
-
-   if (pos >= vecEnd) {
-      // Move the elements after the end to the right.
-      size_t size = pos - vecEnd + (end - start);
-      // Copying the data to the position.
-      memcpy(pos, start, end - start);
-      vec->size += (pos - vecEnd) / vec->element_size + (end - start) / vec->element_size;
-   } else {
-      // Move the elements after the end to the right.
-      size_t size = vecEnd - pos;
-      memmove(pos + (end - start), pos, size);
-      // Copying the data to the position.
-      memcpy(pos, start, end - start);
-      vec->size += (end - start) / vec->element_size;
+
+   size_t n = (end - start) / vec->element_size;
+   if (n == 0) return;
+   // Taking the offset before growing, the data may move.
+   size_t offset = (pos - vec->data) / vec->element_size;
+   size_t new_size = (offset > vec->size ? offset : vec->size) + n;
+   __vec_grow_to_fit(vec, new_size - vec->size);
+   pos = vec->data + offset * vec->element_size;
+
+   // Move the elements after the position to the right.
+   if (offset < vec->size)
+      memmove(pos + n * vec->element_size, pos, (vec->size - offset) * vec->element_size);
+   // Copying the data to the position.
+   memcpy(pos, start, n * vec->element_size);
+   vec->size = new_size;
+}
+
+/**
+ * @brief Function to insert several elements at several positions in one pass.
+ * @param vec The vector.
+ * @param pairs The (index, data) pairs, sorted by index. An index refers to the vector
+ * before the call, the element is inserted before it (vec_size() appends). Pairs with
+ * the same index are inserted in the given order.
+ * @param k The number of pairs.
+ * Time complexity: O(n + k)
+ * @note The vector grows at most once and every element is moved at most once, where k calls
+ * to vec_insert() would move the tail k times.
+ * @warning The data of the pairs must not point inside the vector itself.
+ */
+void vec_insert_batch(vector* vec, vec_insert_pair* pairs, size_t k) {
+   if (k == 0) return;
+   size_t es = vec->element_size;
+   __vec_grow_to_fit(vec, k);
+
+   // Walking the pairs backward, each block of old elements moves straight to its final place.
+   size_t tail = vec->size;
+   for (size_t j = k; j-- > 0;) {
+      size_t index = pairs[j].index;
+      assert(index <= tail && "Pairs must be sorted by index and inside the vector");
+      memmove(vec->data + (index + j + 1) * es, vec->data + index * es, (tail - index) * es);
+      memcpy(vec->data + (index + j) * es, pairs[j].data, es);
+      tail = index;
+   }
+   vec->size += k;
+}
+
+/**
+ * @brief Function to merge a sorted range into a sorted vector.
+ * @param vec The vector, sorted according to `cmp`.
+ * @param start The start pointer of the range, sorted according to `cmp`.
+ * @param end The end pointer of the range.
+ * @param cmp The comparator function.
+ * Time complexity: O(n + k), k is the number of elements in the range
+ * @note The merge runs backward inside the vector, so no temporary buffer is needed.
+ * Elements of the range are placed after the equal elements of the vector.
+ * @warning The range must not point inside the vector itself.
+ */
+void vec_insert_sorted_batch(vector* vec, void* start, void* end, int (*cmp)(void*, void*)) {
+   assert(start <= end && "Start pointer must be less than or equal to end pointer");
+   assert((end - start) % vec->element_size == 0 && "Invalid range");
+   size_t es = vec->element_size;
+   size_t k = (end - start) / es;
+   if (k == 0) return;
+   __vec_grow_to_fit(vec, k);
+
+   // i and j count the elements of the vector and of the range that are not placed yet.
+   size_t i = vec->size;
+   size_t j = k;
+   while (j > 0) {
+      void* dest = vec->data + (i + j - 1) * es;
+      if (i > 0 && cmp(vec->data + (i - 1) * es, start + (j - 1) * es) > 0) {
+         memcpy(dest, vec->data + (i - 1) * es, es);
+         i--;
+      } else {
+         memcpy(dest, start + (j - 1) * es, es);
+         j--;
+      }
    }
+   vec->size += k;
 }
 
 /**
@@ -944,19 +1324,15 @@ void vec_assign_rng(vector* vec, void* start, void* end) {
 }
 
 /**
- * @brief Function to make the vector size to double the current size.
+ * @brief Function to grow the vector if it is full, according to its growth policy.
  * @param vec The vector.
  * Time complexity: O(n)
+ * @note With the default policy the capacity is doubled.
  * @note This function is used internally by the library.
  */
 void __vec_double_if_full(vector* vec) {
-   // If the vector is full, double the size of the vector.
    if (vec->size == vec->capacity) {
-      // If the size is 0, then double the size to 1.
-      if (vec->size == 0)
-         __force_reserve_to(vec, 1);
-      else
-         __force_reserve_to(vec, vec->capacity * 2);
+      __force_reserve_to(vec, __vec_next_capacity(vec, vec->size + 1));
    }
 }
 
@@ -968,12 +1344,230 @@ void __vec_double_if_full(vector* vec) {
  * @note If the vector is full, then the vector size is doubled.
  */
 void vec_push_back(vector* vec, void* data) {
+   // Reserving a slot at the end of the vector and copying the data into it.
+   memcpy(vec_emplace_back(vec), data, vec->element_size);
+}
+
+/**
+ * @brief Function to make sure the vector can hold `n` more elements without reallocating.
+ * @param vec The vector.
+ * @param n The number of elements that will be added.
+ * Time complexity: O(n)
+ * @note The capacity grows at least by the growth policy, so repeated calls stay amortized O(1).
+ * @note This function is used internally by the library.
+ */
+void __vec_grow_to_fit(vector* vec, size_t n) {
+   size_t required = vec->size + n;
+   if (required <= vec->capacity) return;
+   __force_reserve_to(vec, __vec_next_capacity(vec, required));
+}
+
+/**
+ * @brief Function to reserve one uninitialized slot at the end of the vector.
+ * @param vec The vector.
+ * @return A void pointer to the new last element, to be constructed in place by the caller.
+ * Time complexity: O(1)
+ * @note If the vector is full, then the vector size is doubled.
+ * @warning The returned pointer is invalidated by the next call that reallocates the vector.
+ */
+void* vec_emplace_back(vector* vec) {
    // Check if the vector is full. If full, double the size of the vector.
    __vec_double_if_full(vec);
-   // Copying the data to the end of the vector.
    void* dest = vec->data + vec->size * vec->element_size;
    vec->size++;
-   memcpy(dest, data, vec->element_size);
+   return dest;
 }
 
+/**
+ * @brief Function to reserve `n` uninitialized slots at the end of the vector with a single growth step.
+ * @param vec The vector.
+ * @param n The number of elements to add.
+ * @return A void pointer to the first of the new elements, to be constructed in place by the caller.
+ * Time complexity: O(n)
+ * @warning The returned pointer is invalidated by the next call that reallocates the vector.
+ */
+void* vec_push_back_uninit_n(vector* vec, size_t n) {
+   __vec_grow_to_fit(vec, n);
+   void* dest = vec->data + vec->size * vec->element_size;
+   vec->size += n;
+   return dest;
+}
+
+/**
+ * @brief Function to append the range [start, end) to the end of the vector.
+ * @param vec The vector.
+ * @param start The start pointer.
+ * @param end The end pointer.
+ * Time complexity: O(n)
+ * @note The vector grows at most once and the range is copied with a single memcpy.
+ * @warning The range must not point inside the vector itself.
+ */
+void vec_append_rng(vector* vec, void* start, void* end) {
+   assert(start <= end && "Start pointer must be less than or equal to end pointer");
+   assert((end - start) % vec->element_size == 0 && "Invalid range");
+   size_t n = (end - start) / vec->element_size;
+   if (n == 0) return;
+   memcpy(vec_push_back_uninit_n(vec, n), start, end - start);
+}
+
+/**
+ * @brief Function to append `n` elements starting from `start` to the end of the vector.
+ * @param vec The vector.
+ * @param start The start pointer.
+ * @param n The number of elements to append.
+ * Time complexity: O(n)
+ * @warning The range must not point inside the vector itself.
+ */
+void vec_append_n(vector* vec, void* start, size_t n) {
+   vec_append_rng(vec, start, start + n * vec->element_size);
+}
+
+/**
+ * @brief Function to append all the elements of an array to the end of the vector.
+ * @param vec The vector.
+ * @param arr The array. Its element size must match the element size of the vector.
+ * Time complexity: O(n)
+ * @note The elements are shallow copied, the array still owns them.
+ */
+void vec_append_from_array(vector* vec, array* arr) {
+   assert(arr->element_size == vec->element_size && "Element size mismatch");
+   vec_append_n(vec, arr->data, arr->size);
+}
+
+/**
+ * @brief Function to append all the elements of a linked list to the end of the vector.
+ * @param vec The vector.
+ * @param list The linked list. Its element size must match the element size of the vector.
+ * Time complexity: O(n)
+ * @note The vector grows once, then each node is copied straight into its final slot.
+ * @note The elements are shallow copied, the list still owns them.
+ */
+void vec_append_from_list(vector* vec, linked_list* list) {
+   assert(list->element_size == vec->element_size && "Element size mismatch");
+   void* dest = vec_push_back_uninit_n(vec, list->size);
+   for (ll_node* curr = list->head; curr; curr = curr->next) {
+      memcpy(dest, curr->data, vec->element_size);
+      dest += vec->element_size;
+   }
+}
+
+/**
+ * @brief Function to get the default growth policy.
+ * @return A policy that doubles the capacity, starts at 1 element, never shrinks and
+ * moves to mmap backed storage above VEC_MMAP_THRESHOLD bytes.
+ * Time complexity: O(1)
+ */
+vec_growth_policy vec_growth_default(void) {
+   return vec_growth_factor(2, 1);
+}
+
+/**
+ * @brief Function to get a growth policy with the given growth factor.
+ * @param factor_num The numerator of the growth factor.
+ * @param factor_den The denominator of the growth factor.
+ * @return A policy growing by `factor_num / factor_den`, other fields are set like the default policy.
+ * Time complexity: O(1)
+ * @note e.g. vec_growth_factor(3, 2) grows by 1.5x, which lets freed blocks be reused by later growth.
+ */
+vec_growth_policy vec_growth_factor(size_t factor_num, size_t factor_den) {
+   assert(factor_den > 0 && factor_num > factor_den && "Growth factor must be greater than 1");
+   vec_growth_policy policy;
+   policy.factor_num = factor_num;
+   policy.factor_den = factor_den;
+   policy.min_capacity = 1;
+   policy.huge_threshold = 0;
+   policy.huge_increment = 0;
+   policy.page_size = 0;
+   policy.shrink_divisor = 0;
+   policy.mmap_threshold = VEC_MMAP_THRESHOLD;
+   policy.huge_pages = VEC_HUGE_PAGES_NONE;
+   return policy;
+}
+
+/**
+ * @brief Function to set the growth policy of the vector.
+ * @param vec The vector.
+ * @param policy The new policy. It is used from the next reallocation.
+ * Time complexity: O(1)
+ * @note Vectors with a custom allocator never move to mmap storage, their mmap_threshold stays 0.
+ */
+void vec_set_growth_policy(vector* vec, vec_growth_policy policy) {
+   assert(policy.factor_den > 0 && policy.factor_num > policy.factor_den && "Growth factor must be greater than 1");
+   assert((policy.huge_threshold == 0 || policy.huge_increment > 0) && "Huge increment must be positive");
+   assert((policy.shrink_divisor == 0 || policy.shrink_divisor > 1) && "Shrink divisor must be greater than 1");
+   vec->growth = policy;
+   if (!dsa_is_default_allocator(&vec->allocator)) vec->growth.mmap_threshold = 0;
+}
+
+/**
+ * @brief Function to get the reallocation counters of the vector.
+ * @param vec The vector.
+ * @return The counters.
+ * Time complexity: O(1)
+ */
+vec_stats vec_get_stats(vector* vec) {
+   return vec->stats;
+}
+
+/**
+ * @brief Function to reset the reallocation counters of the vector.
+ * @param vec The vector.
+ * Time complexity: O(1)
+ */
+void vec_reset_stats(vector* vec) {
+   vec->stats.reallocs = 0;
+   vec->stats.bytes_copied = 0;
+}
+
+/**
+ * @brief Function to compute the capacity the vector grows to, to hold at least `required` elements.
+ * @param vec The vector.
+ * @param required The number of elements the vector must be able to hold.
+ * @return The new capacity.
+ * Time complexity: O(1)
+ * @note This function is used internally by the library.
+ */
+size_t __vec_next_capacity(vector* vec, size_t required) {
+   vec_growth_policy* policy = &vec->growth;
+   size_t element_size = vec->element_size;
+   size_t capacity = vec->capacity;
+   if (capacity == 0)
+      capacity = policy->min_capacity;
+   else if (policy->huge_threshold && capacity * element_size >= policy->huge_threshold)
+      // Big vectors grow linearly, to bound the wasted memory and the cost of each copy.
+      capacity += (policy->huge_increment + element_size - 1) / element_size;
+   else
+      capacity = capacity * policy->factor_num / policy->factor_den;
+   if (capacity <= vec->capacity) capacity = vec->capacity + 1;
+   if (capacity < required) capacity = required;
+   if (capacity < policy->min_capacity) capacity = policy->min_capacity;
+   if (policy->page_size) {
+      // Using the whole last page, as the allocator hands it out anyway.
+      size_t bytes = capacity * element_size;
+      bytes = (bytes + policy->page_size - 1) / policy->page_size * policy->page_size;
+      capacity = bytes / element_size;
+   }
+   return capacity;
+}
+
+/**
+ * @brief Function to release memory if the vector became sparse, according to its growth policy.
+ * @param vec The vector.
+ * Time complexity: O(n)
+ * @note The capacity is shrunk to what one growth step from the current size would give,
+ * so a following push_back does not reallocate again.
+ * @note This function is used internally by the library.
+ */
+void __vec_shrink_if_sparse(vector* vec) {
+   vec_growth_policy* policy = &vec->growth;
+   if (policy->shrink_divisor == 0 || vec->capacity <= policy->min_capacity) return;
+   if (vec->size > vec->capacity / policy->shrink_divisor) return;
+   size_t capacity = vec->size * policy->factor_num / policy->factor_den;
+   if (capacity <= vec->size) capacity = vec->size + 1;
+   if (capacity < policy->min_capacity) capacity = policy->min_capacity;
+   if (capacity < vec->capacity) __force_reserve_to(vec, capacity);
+}
+
+#endif // c_dsa_generic_vector_c
+
 // End of 'Data Structures/Vector/Vector.c'
@@ -2,6 +2,94 @@
 #define c_dsa_generic_vector_h
 
 #include "stddef.h"
+#include "../Array/array.h"
+#include "../Linked List/linked_list.h"
+#include "../../Memory/allocator.h"
+#include "../../Algorithms/type.h"
+
+// Size in bytes above which a growing vector moves to mmap backed storage. 0 disables it.
+#ifndef VEC_MMAP_THRESHOLD
+#define VEC_MMAP_THRESHOLD ((size_t)64 << 20)
+#endif
+
+// Size of the pages used by VEC_HUGE_PAGES_HUGETLB.
+#ifndef VEC_HUGE_PAGE_SIZE
+#define VEC_HUGE_PAGE_SIZE ((size_t)2 << 20)
+#endif
+
+/**
+ * @brief Huge page usage of mmap backed vectors.
+ * @var VEC_HUGE_PAGES_NONE Normal pages.
+ * @var VEC_HUGE_PAGES_TRANSPARENT Ask the kernel for transparent huge pages with madvise.
+ * @var VEC_HUGE_PAGES_HUGETLB Try to map explicit huge pages, falling back to transparent huge pages.
+*/
+typedef enum vec_huge_pages {
+   VEC_HUGE_PAGES_NONE,
+   VEC_HUGE_PAGES_TRANSPARENT,
+   VEC_HUGE_PAGES_HUGETLB,
+} vec_huge_pages;
+
+/**
+ * @brief Policy that decides how the capacity of a vector changes.
+ * @var size_t factor_num Numerator of the growth factor (2 for 2x, 3 for 1.5x).
+ * @var size_t factor_den Denominator of the growth factor (1 for 2x, 2 for 1.5x).
+ * @var size_t min_capacity The capacity of the first allocation of an empty vector.
+ * @var size_t huge_threshold Size in bytes above which the vector grows by `huge_increment` bytes
+ * instead of by the growth factor. 0 disables it.
+ * @var size_t huge_increment Number of bytes to grow by once the vector is above `huge_threshold`.
+ * @var size_t page_size If non zero, grown allocations are rounded up to a multiple of it.
+ * @var size_t shrink_divisor If non zero, vec_pop_back and vec_erase release memory once the size drops
+ * to `capacity / shrink_divisor`. Use a divisor larger than the growth factor to avoid thrashing.
+ * @var size_t mmap_threshold Size in bytes above which the vector moves to mmap backed storage,
+ * where growing uses mremap and never copies. 0 disables it, vectors with a custom allocator always use 0.
+ * @var vec_huge_pages huge_pages Huge page usage once the vector is mmap backed.
+*/
+typedef struct vec_growth_policy {
+   size_t factor_num;
+   size_t factor_den;
+   size_t min_capacity;
+   size_t huge_threshold;
+   size_t huge_increment;
+   size_t page_size;
+   size_t shrink_divisor;
+   size_t mmap_threshold;
+   vec_huge_pages huge_pages;
+} vec_growth_policy;
+
+/**
+ * @brief Counters about the reallocations done by a vector.
+ * @var size_t reallocs Number of times the buffer of the vector was reallocated.
+ * @var size_t bytes_copied Number of bytes moved because a reallocation could not be done in place.
+*/
+typedef struct vec_stats {
+   size_t reallocs;
+   size_t bytes_copied;
+} vec_stats;
+
+/**
+ * @brief Where the data of a vector lives.
+ * @var VEC_STORAGE_HEAP The data is allocated on the heap and owned by the vector.
+ * @var VEC_STORAGE_INLINE The data lives in a buffer embedded in the owner of the vector (see sbo_vector).
+ * It is never freed by the vector, and moved to the heap when the vector outgrows it.
+ * @var VEC_STORAGE_MMAP The data is an anonymous mapping, grown and shrunk with mremap.
+ * @var VEC_STORAGE_MMAP_HUGE Same as VEC_STORAGE_MMAP, mapped with explicit huge pages.
+*/
+typedef enum vec_storage {
+   VEC_STORAGE_HEAP,
+   VEC_STORAGE_INLINE,
+   VEC_STORAGE_MMAP,
+   VEC_STORAGE_MMAP_HUGE,
+} vec_storage;
+
+/**
+ * @brief An element to insert with vec_insert_batch().
+ * @var size_t index The index, in the vector before the batch, to insert before.
+ * @var void* data Pointer to the element, it is copied.
+*/
+typedef struct vec_insert_pair {
+   size_t index;
+   void* data;
+} vec_insert_pair;
 
 /**
  * @brief A generic vector data structure.
@@ -11,6 +99,13 @@
  * @var void* data A pointer to the data in the vector.
  * @var void (*destroyer)(void*) A function pointer to a function that destroys the data
  * allocated by the user in the vector. It is called when a vector is removed using library functions.
+ * @var vec_growth_policy growth The policy used when the vector grows or shrinks.
+ * @var vec_stats stats Reallocation counters of the vector.
+ * @var vec_storage storage Where the data of the vector lives.
+ * @var dsa_allocator allocator The allocator used for the heap storage of the vector.
+ * @var size_t alignment The alignment of the data, 0 for the default alignment of the allocator.
+ * Heap allocations are also padded to a multiple of it.
+ * @var const dsa_type* type The descriptor of the elements, NULL if unknown.
 */
 typedef struct vector {
    size_t size;
@@ -18,11 +113,21 @@ typedef struct vector {
    size_t capacity;
    void* data;
    void (*destroyer)(void*);
+   vec_growth_policy growth;
+   vec_stats stats;
+   vec_storage storage;
+   dsa_allocator allocator;
+   size_t alignment;
+   const dsa_type* type;
 } vector;
 
 
+vector vec_init_with_allocator(size_t size, size_t element_size, void (*destroyer)(void*), dsa_allocator* allocator);
 vector vec_init_with_destroyer(size_t size, size_t element_size, void (*destroyer)(void*));
 vector vec_init(size_t size, size_t element_size);
+vector vec_init_aligned(size_t size, size_t element_size, size_t alignment);
+vector vec_init_typed(size_t size, const dsa_type* type);
+vector vec_init_mmap(size_t size, size_t element_size, vec_huge_pages huge_pages);
 size_t vec_capacity(vector* vec);
 size_t vec_size(vector* vec);
 size_t vec_max_size(vector* vec);
@@ -30,9 +135,10 @@ size_t vec_element_size(vector* vec);
 int vec_empty(vector* vec);
 void* vec_begin(vector* vec);
 void* vec_end(vector* vec);
+void* vec_padded_end(vector* vec);
 void* vec_front(vector* vec);
 void* vec_back(vector* vec);
-void __check_range(vector* vec, void* start, void* end);
+void __vec_check_range(vector* vec, void* start, void* end);
 void vec_for_each_idx(vector* vec, void (*callback)(void*, size_t));
 void vec_for_each(vector* vec, void (*callback)(void*));
 void vec_for_each_n_idx(vector* vec, void* start, size_t n, void (*callback)(void*, size_t));
@@ -63,6 +169,8 @@ void vec_sort_n_cmp(vector* vec, void* start, size_t n, int (*cmp)(void*, void*)
 void vec_sort_n(vector* vec, void* start, size_t n);
 void vec_sort_rng_cmp(vector* vec, void* start, void* end, int (*cmp)(void*, void*));
 void vec_sort_rng(vector* vec, void* start, void* end);
+size_t vec_hash(vector* vec);
+size_t vec_serialize(vector* vec, void* out);
 void vec_fill_rng(vector* vec, void* start, void* end, void* data);
 void vec_fill(vector* vec, void* data);
 void vec_fill_n(vector* vec, void* start, size_t n, void* data);
@@ -73,6 +181,10 @@ void __vec_destroyer(vector* vec);
 void vec_free(vector* vec);
 void vec_clear(vector* vec);
 void __force_reserve_to(vector* vec, size_t size);
+size_t __vec_alloc_bytes(vector* vec, size_t capacity);
+void __vec_spill_to_heap(vector* vec, size_t size);
+int __vec_mmap_reserve(vector* vec, size_t size);
+void __vec_release_pages(vector* vec, size_t keep);
 void __force_resize_to(vector* vec, size_t size);
 void vec_resize(vector* vec, size_t size);
 void vec_reserve(vector* vec, size_t size);
@@ -88,6 +200,22 @@ void vec_erase_rng(vector* vec, void* start, void* end);
 void vec_erase(vector* vec, void* pos);
 void vec_insert(vector* vec, void* pos, void* data);
 void vec_insert_rng(vector* vec, void* pos, void* start, void* end);
+void vec_insert_batch(vector* vec, vec_insert_pair* pairs, size_t k);
+void vec_insert_sorted_batch(vector* vec, void* start, void* end, int (*cmp)(void*, void*));
+void __vec_grow_to_fit(vector* vec, size_t n);
+void* vec_emplace_back(vector* vec);
+void* vec_push_back_uninit_n(vector* vec, size_t n);
+void vec_append_rng(vector* vec, void* start, void* end);
+void vec_append_n(vector* vec, void* start, size_t n);
+void vec_append_from_array(vector* vec, array* arr);
+void vec_append_from_list(vector* vec, linked_list* list);
+vec_growth_policy vec_growth_default(void);
+vec_growth_policy vec_growth_factor(size_t factor_num, size_t factor_den);
+void vec_set_growth_policy(vector* vec, vec_growth_policy policy);
+vec_stats vec_get_stats(vector* vec);
+void vec_reset_stats(vector* vec);
+size_t __vec_next_capacity(vector* vec, size_t required);
+void __vec_shrink_if_sparse(vector* vec);
 
 
 
@@ -0,0 +1,31 @@
+#include "stdio.h"
+#include "../../Data Structures/Bit Vector/bit_vector.h"
+#include "../../Data Structures/Bit Vector/bit_vector.c" // TODO: Remove this line
+
+void log_index(size_t index) {
+   printf("%ld ", index);
+}
+
+int main() {
+   // One bit per flag instead of one byte
+   bit_vector even = bv_init(40);
+   bit_vector div3 = bv_init(40);
+   for (size_t i = 0; i < 40; i++) {
+      if (i % 2 == 0) bv_set(&even, i);
+      if (i % 3 == 0) bv_set(&div3, i);
+   }
+
+   // Whole vectors are combined a word at a time
+   bv_and(&even, &div3);
+   printf("Divisible by 6: ");
+   bv_for_each_set(&even, log_index);
+   printf("\nCount: %ld\n", bv_count(&even));
+
+   bv_build_index(&div3);
+   printf("Multiples of 3 below 20: %ld\n", bv_rank(&div3, 20));
+   printf("5th multiple of 3: %ld\n", bv_select(&div3, 5));
+
+   bv_free(&even);
+   bv_free(&div3);
+   return 0;
+}
@@ -0,0 +1,43 @@
+#include "stdio.h"
+#include "../../Data Structures/Compact List/compact_list.h"
+#include "../../Data Structures/Compact List/compact_list.c" // TODO: Remove this
+
+void print_int(void* data) {
+   printf("%d ", *(int*)data);
+}
+
+int is_even(void* data) {
+   return *(int*)data % 2 == 0;
+}
+
+int main() {
+   compact_list list = cl_init(sizeof(int));
+   cl_reserve(&list, 16);
+
+   for (int i = 0; i < 10; i++)
+      cl_push_back(&list, &i);
+
+   int x = 100;
+   cl_push_front(&list, &x);
+   uint32_t node = cl_find(&list, &(int){5});
+   cl_insert_after(&list, node, &x);
+
+   printf("List    : ");
+   cl_for_each(&list, print_int);
+
+   // Removed nodes go to the free list and are reused by the next insertions
+   printf("\nRemoved : %zu even numbers", cl_remove_if(&list, is_even));
+   cl_pop_front(&list);
+   cl_reverse(&list);
+
+   printf("\nReversed: ");
+   for (uint32_t i = cl_begin(&list); i != CL_NIL; i = cl_next(&list, i))
+      printf("%d ", *(int*)cl_data(&list, i));
+
+   int out[16];
+   size_t bytes = cl_serialize(&list, out);
+   printf("\nSerialized %zu bytes, first element %d, %zu nodes allocated\n", bytes, out[0], list.slots.size);
+
+   cl_free(&list);
+   return 0;
+}
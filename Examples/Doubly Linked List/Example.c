@@ -0,0 +1,40 @@
+#include "stdio.h"
+#include "../../Data Structures/Doubly Linked List/doubly_linked_list.h"
+#include "../../Data Structures/Doubly Linked List/doubly_linked_list.c" // TODO: Remove this
+
+void print_node(dll_node* node) {
+   printf("%d ", *(int*)dll_data(node));
+}
+
+int main() {
+   doubly_linked_list list = dll_init(sizeof(int));
+
+   for (int i = 1; i <= 5; i++)
+      dll_push_back(&list, &i);
+   int zero = 0;
+   dll_push_front(&list, &zero);
+
+   printf("Forward  : ");
+   dll_for_each(&list, print_node);
+   printf("\nBackward : ");
+   dll_for_each_reverse(&list, print_node);
+
+   // Removing the tail or a known node does not walk the list
+   dll_pop_back(&list);
+   int three = 3;
+   dll_node* node = dll_find(&list, &three);
+   int thirty = 30;
+   dll_insert_after(&list, node, &thirty);
+   dll_erase(&list, node);
+
+   printf("\nEdited   : ");
+   dll_for_each(&list, print_node);
+
+   dll_reverse(&list);
+   printf("\nReversed : ");
+   dll_for_each(&list, print_node);
+   printf("\nSize: %ld\n", dll_size(&list));
+
+   dll_free(&list);
+   return 0;
+}
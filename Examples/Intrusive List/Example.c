@@ -0,0 +1,50 @@
+#include "stdio.h"
+#include "../../Data Structures/Intrusive List/intrusive_list.h"
+#include "../../Data Structures/Intrusive List/intrusive_list.c" // TODO: Remove this
+
+// A task is in the list of all tasks and, while it is ready, in the ready queue too
+typedef struct Task {
+   int id;
+   il_link all;
+   il_link ready;
+} Task;
+
+void print_all(il_link* link) {
+   printf("%d ", IL_CONTAINER_OF(link, Task, all)->id);
+}
+
+void print_ready(il_link* link) {
+   printf("%d ", IL_CONTAINER_OF(link, Task, ready)->id);
+}
+
+int main() {
+   Task tasks[5];
+   intrusive_list all = il_init();
+   intrusive_list ready = il_init();
+
+   // No allocation, the links live inside the tasks
+   for (int i = 0; i < 5; i++) {
+      tasks[i].id = i;
+      il_link_init(&tasks[i].all);
+      il_link_init(&tasks[i].ready);
+      il_push_back(&all, &tasks[i].all);
+      if (i % 2 == 0) il_push_back(&ready, &tasks[i].ready);
+   }
+
+   printf("All   : ");
+   il_for_each(&all, print_all);
+   printf("\nReady : ");
+   il_for_each(&ready, print_ready);
+
+   // A task leaves the ready queue without searching it
+   il_remove(&tasks[2].ready);
+   Task* next = IL_CONTAINER_OF(il_pop_front(&ready), Task, ready);
+
+   printf("\nRan task %d, still ready: ", next->id);
+   il_for_each(&ready, print_ready);
+   printf("\nTask 2 is ready: %d, task 2 exists: %d\n", il_is_linked(&tasks[2].ready), il_contains(&all, &tasks[2].all));
+
+   il_clear(&ready);
+   il_clear(&all);
+   return 0;
+}
@@ -0,0 +1,47 @@
+#include "stdio.h"
+#include "../../Data Structures/NDArray/ndarray.h"
+#include "../../Data Structures/NDArray/ndarray.c" // TODO: Remove this line
+
+void add_int(void* acc, void* element) {
+   *(int*)acc += *(int*)element;
+}
+
+void log_int(void* data) {
+   printf("%d ", *(int*)data);
+}
+
+int main() {
+   size_t shape[] = { 3, 4 };
+   ndarray matrix = nd_init(2, shape, sizeof(int));
+   for (size_t i = 0; i < 3; i++)
+      for (size_t j = 0; j < 4; j++)
+         *(int*)nd_at2(&matrix, i, j) = i * 4 + j;
+
+   // Views share the elements, nothing is copied
+   ndarray column = nd_index(&matrix, 1, 2);
+   printf("Column 2: ");
+   nd_for_each(&column, log_int);
+
+   ndarray transposed = nd_transpose(&matrix, 0, 1);
+   printf("\nTransposed view: ");
+   nd_for_each(&transposed, log_int);
+
+   size_t shape_t[] = { 4, 3 };
+   ndarray copy = nd_init(2, shape_t, sizeof(int));
+   nd_transpose_into(&copy, &matrix);
+   printf("\nContiguous transposed copy: %d\n", nd_is_contiguous(&copy));
+
+   // Sum of every column
+   size_t shape_sum[] = { 4 };
+   ndarray sums = nd_init(1, shape_sum, sizeof(int));
+   int zero = 0;
+   nd_reduce_axis(&matrix, 0, &sums, &zero, add_int);
+   printf("Column sums: ");
+   nd_for_each(&sums, log_int);
+   printf("\n");
+
+   nd_free(&sums);
+   nd_free(&copy);
+   nd_free(&matrix);
+   return 0;
+}
@@ -0,0 +1,44 @@
+#include "stdio.h"
+#include "../../Data Structures/Persistent Vector/pvec.h"
+#include "../../Data Structures/Persistent Vector/pvec.c" // TODO: Remove this line
+
+void log_int(const void* data) {
+   printf("%d ", *(const int*)data);
+}
+
+int main() {
+   // Undo history: every edit keeps the previous versions intact
+   pvec history[4];
+   history[0] = pvec_init(sizeof(int));
+
+   // A transient batches many updates without copying every time
+   pvec transient = pvec_transient(&history[0]);
+   for (int i = 0; i < 10; i++)
+      pvec_t_push_back(&transient, &i);
+   history[1] = pvec_persistent(&transient);
+
+   int value = 100;
+   history[2] = pvec_set(&history[1], 5, &value);
+   history[3] = pvec_pop_back(&history[2]);
+
+   for (int i = 0; i < 4; i++) {
+      printf("Version %d: ", i);
+      pvec_for_each(&history[i], log_int);
+      printf("\n");
+   }
+
+   pvec head = pvec_take(&history[3], 3);
+   pvec both = pvec_concat(&head, &history[1]);
+   printf("Concat: ");
+   pvec_for_each(&both, log_int);
+
+   vector vec = pvec_to_vector(&both);
+   printf("\nAs a vector of size %ld\n", vec_size(&vec));
+
+   vec_free(&vec);
+   pvec_free(&both);
+   pvec_free(&head);
+   for (int i = 0; i < 4; i++)
+      pvec_free(&history[i]);
+   return 0;
+}
@@ -0,0 +1,47 @@
+#include "stdio.h"
+#include "../../Data Structures/SBO Vector/sbo_vector.h"
+#include "../../Data Structures/SBO Vector/sbo_vector.c" // TODO: Remove this line
+
+void log_int(void* data) {
+   printf("%d ", *(int*)data);
+}
+
+int main() {
+   sbo_vector v = sbo_init(sizeof(int));
+   int arr[] = { 5, 3, 8, 1, 9, 2 };
+
+   for (int i = 0; i < 6; i++)
+      sbo_push_back(&v, arr + i);
+
+   // Few elements, no heap allocation yet
+   printf("Inline: %d, Capacity: %ld\n", sbo_is_inline(&v), sbo_capacity(&v));
+
+   sbo_sort(&v);
+   sbo_for_each(&v, log_int);
+
+   // Every vec_* function works on the view
+   vec_reverse(sbo_view(&v));
+   printf("\nReversed: ");
+   sbo_for_each(&v, log_int);
+
+   for (int i = 0; i < 100; i++)
+      sbo_push_back(&v, &i);
+
+   // Outgrew the embedded buffer, now on the heap
+   printf("\nInline: %d, Capacity: %ld\n", sbo_is_inline(&v), sbo_capacity(&v));
+
+   // Past VEC_MMAP_THRESHOLD bytes the storage becomes an anonymous mapping
+   size_t large = VEC_MMAP_THRESHOLD / sizeof(int) + 1;
+   for (size_t i = sbo_size(&v); i < large; i++)
+      sbo_push_back(&v, &(int){ 0 });
+   printf("Large: %ld elements, Mapped: %d\n", sbo_size(&v), sbo_view(&v)->storage != VEC_STORAGE_HEAP);
+
+   // Back to a few elements, shrinking releases the mapping and moves them inline again
+   while (sbo_size(&v) > 4)
+      sbo_pop_back(&v);
+   sbo_shrink_to_fit(&v);
+   printf("Inline: %d, Capacity: %ld, Front: %d\n", sbo_is_inline(&v), sbo_capacity(&v), *(int*)sbo_front(&v));
+
+   sbo_free(&v);
+   return 0;
+}
@@ -0,0 +1,36 @@
+#include "stdio.h"
+#include "../../Data Structures/Segmented Vector/seg_vector.h"
+#include "../../Data Structures/Segmented Vector/seg_vector.c" // TODO: Remove this line
+
+void log_int(void* data) {
+   printf("%d ", *(int*)data);
+}
+
+int main() {
+   seg_vector v = seg_init(sizeof(int));
+   int arr[] = { 5, 3, 8, 1, 9, 2 };
+
+   for (int i = 0; i < 6; i++)
+      seg_push_back(&v, arr + i);
+
+   int* first = seg_front(&v);
+
+   // Growing adds blocks, nothing is moved
+   for (int i = 0; i < 1000; i++)
+      seg_push_back(&v, &i);
+   printf("Size: %ld, Capacity: %ld, Blocks: %ld\n", seg_size(&v), seg_capacity(&v), v.block_count);
+   printf("First element is still at the same address: %d\n", first == seg_front(&v));
+
+   while (seg_size(&v) > 6)
+      seg_pop_back(&v);
+   seg_shrink_to_fit(&v);
+
+   seg_sort(&v);
+   seg_for_each(&v, log_int);
+
+   int value = 8;
+   printf("\n8 is at index %ld\n", seg_find(&v, &value));
+
+   seg_free(&v);
+   return 0;
+}
@@ -0,0 +1,54 @@
+#include "pthread.h"
+#include "stdio.h"
+#include "../../Data Structures/Snapshot Vector/snap_vector.h"
+#include "../../Data Structures/Snapshot Vector/snap_vector.c" // TODO: Remove this line
+
+snap_vector table;
+
+void* reader(void* arg) {
+   long long checks = 0;
+   for (int round = 0; round < 100000; round++) {
+      // A version never changes while it is held, however many commits happen meanwhile
+      snap_version* version = snap_acquire(&table);
+      int first = *(const int*)snap_at(version, 0);
+      int last = *(const int*)snap_at(version, snap_size(version) - 1);
+      checks += first == last;
+      snap_release(version);
+   }
+   *(long long*)arg = checks;
+   return NULL;
+}
+
+int main() {
+   vector config = vec_init(0, sizeof(int));
+   int zero = 0;
+   for (int i = 0; i < 10000; i++)
+      vec_push_back(&config, &zero);
+   snap_init_from_vector(&table, &config);
+   vec_free(&config);
+
+   pthread_t threads[4];
+   long long checks[4];
+   for (int i = 0; i < 4; i++)
+      pthread_create(&threads[i], NULL, reader, &checks[i]);
+
+   // Each update writes the first and last elements, copying only their two blocks
+   for (int value = 1; value <= 1000; value++) {
+      snap_draft draft = snap_begin_write(&table);
+      snap_draft_set(&draft, 0, &value);
+      snap_draft_set(&draft, snap_size(draft.version) - 1, &value);
+      snap_commit(&draft);
+   }
+
+   for (int i = 0; i < 4; i++) {
+      pthread_join(threads[i], NULL);
+      printf("Reader %d saw %lld consistent versions\n", i, checks[i]);
+   }
+
+   snap_version* version = snap_acquire(&table);
+   printf("Latest first element: %d\n", *(const int*)snap_at(version, 0));
+   snap_release(version);
+
+   snap_free(&table);
+   return 0;
+}
@@ -0,0 +1,46 @@
+#include "stdio.h"
+#include "../../Data Structures/SoA Vector/soa_vector.h"
+#include "../../Data Structures/SoA Vector/soa_vector.c" // TODO: Remove this line
+
+typedef struct person {
+   char name[20];
+   int age;
+   double height;
+} person;
+
+enum { NAME, AGE, HEIGHT };
+
+void log_age(void* data) {
+   printf("%d ", *(int*)data);
+}
+
+int main() {
+   soa_field fields[] = { SOA_FIELD(person, name), SOA_FIELD(person, age), SOA_FIELD(person, height) };
+   soa_vector people = soa_init(sizeof(person), fields, 3);
+
+   person list[] = { { "Alice", 31, 1.65 }, { "Bob", 25, 1.80 }, { "Carol", 42, 1.72 }, { "Dave", 19, 1.90 } };
+   for (int i = 0; i < 4; i++)
+      soa_push_back(&people, list + i);
+
+   // Scanning one field only reads its column
+   printf("Ages: ");
+   for_each(soa_column_begin(&people, AGE), soa_column_end(&people, AGE), sizeof(int), log_age);
+
+   int age = 42;
+   person p;
+   soa_get(&people, soa_find(&people, AGE, &age), &p);
+   printf("\n42 years old: %s\n", p.name);
+
+   // Sorting by a column moves the whole rows
+   soa_sort_by_column(&people, AGE, int_cmp);
+   for (size_t i = 0; i < soa_size(&people); i++) {
+      soa_get(&people, i, &p);
+      printf("%s %d %.2f\n", p.name, p.age, p.height);
+   }
+
+   soa_erase(&people, 0);
+   printf("Size after erase: %ld\n", soa_size(&people));
+
+   soa_free(&people);
+   return 0;
+}
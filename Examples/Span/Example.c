@@ -0,0 +1,39 @@
+#include "stdio.h"
+#include "../../Data Structures/Span/span.h"
+#include "../../Data Structures/Span/span.c" // TODO: Remove this line
+
+typedef struct person {
+   char name[20];
+   int age;
+} person;
+
+void log_int(void* data) {
+   printf("%d ", *(int*)data);
+}
+
+int main() {
+   vector vec = vec_init(0, sizeof(int));
+   int arr[] = { 9, 4, 7, 1, 8, 2, 6, 3, 5, 0 };
+   vec_append_rng(&vec, arr, arr + 10);
+
+   // Sorting the middle of the vector without copying it out
+   dsa_span middle = span_subspan(span_from_vector(&vec), 2, 6);
+   span_sort(middle);
+   span_for_each(span_from_vector(&vec), log_int);
+
+   // Every other element
+   printf("\nEven indexes: ");
+   span_for_each(span_every(span_from_vector(&vec), 2), log_int);
+
+   // A strided view over one field of an array of structs
+   person people[] = { { "Alice", 31 }, { "Bob", 25 }, { "Carol", 42 }, { "Dave", 19 } };
+   dsa_span ages = SPAN_FIELD(people, 4, person, age);
+   span_sort(ages);
+   printf("\nSorted ages: ");
+   span_for_each(ages, log_int);
+   int age = 42;
+   printf("\n42 is at index %ld, names stay in place: %s\n", span_find(ages, &age), people[0].name);
+
+   vec_free(&vec);
+   return 0;
+}
@@ -0,0 +1,44 @@
+#include "stdio.h"
+#include "../../Data Structures/Unrolled List/unrolled_list.h"
+#include "../../Data Structures/Unrolled List/unrolled_list.c" // TODO: Remove this line
+
+void print_int(void* data) {
+   printf("%d ", *(int*)data);
+}
+
+void print_block(void* data, size_t count) {
+   printf("[");
+   for (size_t i = 0; i < count; i++)
+      printf(i ? " %d" : "%d", ((int*)data)[i]);
+   printf("] ");
+}
+
+int main() {
+   // Small blocks to show the splits and merges
+   unrolled_list list = ul_init_with_allocator(sizeof(int), 4, NULL, NULL);
+   for (int i = 0; i < 10; i++)
+      ul_push_back(&list, &i);
+
+   printf("Blocks : ");
+   ul_for_each_block(&list, print_block);
+
+   // Inserting into a full block splits it
+   int value = 100;
+   ul_insert_at(&list, 2, &value);
+   printf("\nInsert : ");
+   ul_for_each_block(&list, print_block);
+
+   // Erasing from a sparse block merges it with a neighbour
+   ul_erase_at(&list, 0);
+   ul_erase_at(&list, 0);
+   printf("\nErase  : ");
+   ul_for_each_block(&list, print_block);
+
+   printf("\nValues : ");
+   ul_for_each(&list, print_int);
+   int nine = 9;
+   printf("\nIndex of 9: %ld, size: %ld, blocks: %ld\n", ul_find(&list, &nine), ul_size(&list), ul_block_count(&list));
+
+   ul_free(&list);
+   return 0;
+}
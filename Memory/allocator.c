@@ -0,0 +1,175 @@
+/**
+ * Pluggable allocator used by the containers of the library.
+ * Author : Abinash Karmakar
+ * 2023-09-01 MIT License Version: 1.0
+ */
+
+#ifndef c_dsa_generic_allocator_c
+#define c_dsa_generic_allocator_c
+
+#include "allocator.h"
+
+#include "assert.h"
+#include "stdlib.h"
+#include "string.h"
+
+void* __dsa_malloc(void* ctx, size_t size) {
+   return malloc(size);
+}
+
+void* __dsa_realloc(void* ctx, void* ptr, size_t old_size, size_t new_size) {
+   return realloc(ptr, new_size);
+}
+
+void __dsa_free(void* ctx, void* ptr, size_t size) {
+   free(ptr);
+}
+
+/**
+ * @brief Function to get the allocator used when none is given.
+ * @return An allocator calling malloc, realloc and free.
+ * Time complexity: O(1)
+ */
+dsa_allocator dsa_default_allocator(void) {
+   dsa_allocator allocator;
+   allocator.alloc = __dsa_malloc;
+   allocator.realloc = __dsa_realloc;
+   allocator.free = __dsa_free;
+   allocator.ctx = NULL;
+   return allocator;
+}
+
+/**
+ * @brief Function to check if an allocator is the default one.
+ * @param allocator The allocator, NULL is the default one.
+ * @return 1 if it uses malloc, realloc and free, 0 otherwise.
+ * Time complexity: O(1)
+ */
+int dsa_is_default_allocator(dsa_allocator* allocator) {
+   return allocator == NULL || allocator->alloc == __dsa_malloc;
+}
+
+/**
+ * @brief Function to allocate memory with an allocator.
+ * @param allocator The allocator, NULL for malloc.
+ * @param size The number of bytes.
+ * @return A pointer to the memory, or NULL on failure.
+ * Time complexity: O(1)
+ */
+void* dsa_alloc(dsa_allocator* allocator, size_t size) {
+   if (allocator == NULL) return malloc(size);
+   return allocator->alloc(allocator->ctx, size);
+}
+
+/**
+ * @brief Function to resize memory allocated with an allocator.
+ * @param allocator The allocator, NULL for realloc.
+ * @param ptr The memory, may be NULL.
+ * @param old_size The current size of the memory in bytes.
+ * @param new_size The new size of the memory in bytes.
+ * @return A pointer to the resized memory, or NULL on failure.
+ * Time complexity: O(n)
+ */
+void* dsa_realloc(dsa_allocator* allocator, void* ptr, size_t old_size, size_t new_size) {
+   if (allocator == NULL) return realloc(ptr, new_size);
+   if (allocator->realloc) return allocator->realloc(allocator->ctx, ptr, old_size, new_size);
+   // No realloc in the allocator, moving the data by hand.
+   void* data = allocator->alloc(allocator->ctx, new_size);
+   if (data == NULL) return NULL;
+   if (ptr != NULL) {
+      memcpy(data, ptr, old_size < new_size ? old_size : new_size);
+      allocator->free(allocator->ctx, ptr, old_size);
+   }
+   return data;
+}
+
+/**
+ * @brief Function to release memory allocated with an allocator.
+ * @param allocator The allocator, NULL for free.
+ * @param ptr The memory, may be NULL.
+ * @param size The size of the memory in bytes.
+ * Time complexity: O(1)
+ */
+void dsa_free(dsa_allocator* allocator, void* ptr, size_t size) {
+   if (ptr == NULL) return;
+   if (allocator == NULL)
+      free(ptr);
+   else
+      allocator->free(allocator->ctx, ptr, size);
+}
+
+/**
+ * @brief Function to round a size up to a multiple of an alignment.
+ * @param size The size.
+ * @param alignment The alignment, 0 or 1 leaves the size unchanged.
+ * @return The rounded size.
+ * Time complexity: O(1)
+ */
+size_t dsa_align_up(size_t size, size_t alignment) {
+   if (alignment <= 1) return size;
+   return (size + alignment - 1) / alignment * alignment;
+}
+
+/**
+ * @brief Function to allocate memory aligned to a power of two with an allocator.
+ * @param allocator The allocator, NULL for malloc.
+ * @param size The number of bytes.
+ * @param alignment The alignment, 0 for the default alignment.
+ * @return A pointer to the memory, or NULL on failure.
+ * Time complexity: O(1)
+ * @note Alignments above DSA_DEFAULT_ALIGNMENT over-allocate and keep the original pointer
+ * just before the returned one, so any allocator can be used.
+ * @warning Release the memory with dsa_free_aligned() and the same alignment.
+ */
+void* dsa_alloc_aligned(dsa_allocator* allocator, size_t size, size_t alignment) {
+   if (alignment <= DSA_DEFAULT_ALIGNMENT) return dsa_alloc(allocator, size);
+   assert((alignment & (alignment - 1)) == 0 && "Alignment must be a power of two");
+   void* raw = dsa_alloc(allocator, size + alignment - 1 + sizeof(void*));
+   if (raw == NULL) return NULL;
+   void* aligned = (void*)dsa_align_up((size_t)raw + sizeof(void*), alignment);
+   ((void**)aligned)[-1] = raw;
+   return aligned;
+}
+
+/**
+ * @brief Function to resize memory allocated with dsa_alloc_aligned().
+ * @param allocator The allocator, NULL for malloc.
+ * @param ptr The memory, may be NULL.
+ * @param old_size The current size of the memory in bytes.
+ * @param new_size The new size of the memory in bytes.
+ * @param alignment The alignment the memory was allocated with, kept by the new memory.
+ * @return A pointer to the resized memory, or NULL on failure.
+ * Time complexity: O(n)
+ */
+void* dsa_realloc_aligned(dsa_allocator* allocator, void* ptr, size_t old_size, size_t new_size, size_t alignment) {
+   if (alignment <= DSA_DEFAULT_ALIGNMENT) return dsa_realloc(allocator, ptr, old_size, new_size);
+   // realloc does not keep the alignment, moving the data by hand.
+   void* data = dsa_alloc_aligned(allocator, new_size, alignment);
+   if (data == NULL) return NULL;
+   if (ptr != NULL) {
+      memcpy(data, ptr, old_size < new_size ? old_size : new_size);
+      dsa_free_aligned(allocator, ptr, old_size, alignment);
+   }
+   return data;
+}
+
+/**
+ * @brief Function to release memory allocated with dsa_alloc_aligned().
+ * @param allocator The allocator, NULL for free.
+ * @param ptr The memory, may be NULL.
+ * @param size The size of the memory in bytes.
+ * @param alignment The alignment the memory was allocated with.
+ * Time complexity: O(1)
+ */
+void dsa_free_aligned(dsa_allocator* allocator, void* ptr, size_t size, size_t alignment) {
+   if (alignment <= DSA_DEFAULT_ALIGNMENT) {
+      dsa_free(allocator, ptr, size);
+      return;
+   }
+   if (ptr == NULL) return;
+   dsa_free(allocator, ((void**)ptr)[-1], size + alignment - 1 + sizeof(void*));
+}
+
+#endif // c_dsa_generic_allocator_c
+
+// End of 'Memory/allocator.c'
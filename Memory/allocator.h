@@ -0,0 +1,35 @@
+#ifndef c_dsa_generic_allocator_h
+#define c_dsa_generic_allocator_h
+
+#include "stddef.h"
+
+// Alignment every allocator guarantees, larger alignments go through dsa_alloc_aligned().
+#define DSA_DEFAULT_ALIGNMENT _Alignof(max_align_t)
+
+/**
+ * @brief Interface used by every container for its internal allocations.
+ * @var alloc Allocates `size` bytes. Returns NULL on failure.
+ * @var realloc Resizes a block from `old_size` to `new_size` bytes. May be NULL, in which case
+ * alloc, memcpy and free are used instead.
+ * @var free Releases a block of `size` bytes.
+ * @var ctx User pointer passed to every function, e.g. the arena or pool to allocate from.
+ * @note Pass NULL wherever a dsa_allocator* is expected to use malloc, realloc and free.
+*/
+typedef struct dsa_allocator {
+   void* (*alloc)(void* ctx, size_t size);
+   void* (*realloc)(void* ctx, void* ptr, size_t old_size, size_t new_size);
+   void (*free)(void* ctx, void* ptr, size_t size);
+   void* ctx;
+} dsa_allocator;
+
+dsa_allocator dsa_default_allocator(void);
+int dsa_is_default_allocator(dsa_allocator* allocator);
+void* dsa_alloc(dsa_allocator* allocator, size_t size);
+void* dsa_realloc(dsa_allocator* allocator, void* ptr, size_t old_size, size_t new_size);
+void dsa_free(dsa_allocator* allocator, void* ptr, size_t size);
+size_t dsa_align_up(size_t size, size_t alignment);
+void* dsa_alloc_aligned(dsa_allocator* allocator, size_t size, size_t alignment);
+void* dsa_realloc_aligned(dsa_allocator* allocator, void* ptr, size_t old_size, size_t new_size, size_t alignment);
+void dsa_free_aligned(dsa_allocator* allocator, void* ptr, size_t size, size_t alignment);
+
+#endif // c_dsa_generic_allocator_h